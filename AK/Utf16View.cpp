@@ -4,8 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Concepts.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Utf16String.h>
@@ -245,6 +248,147 @@ Utf16View Utf16View::unicode_substring_view(size_t code_point_offset, size_t cod
     VERIFY_NOT_REACHED();
 }
 
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+// Substring search that filters candidate offsets by comparing both the first and the last code unit of the needle
+// against a whole vector of the haystack at once. The remaining code units are only compared at offsets where both
+// of those match, which on typical text rejects nearly every offset without ever looking at the rest of the needle.
+template<SearchDirection direction, typename HaystackType, typename NeedleType>
+static Optional<size_t> find_substring_offset(ReadonlySpan<HaystackType> haystack, ReadonlySpan<NeedleType> needle, size_t start_offset)
+{
+    using CodeUnit = Conditional<sizeof(HaystackType) == 1, u8, u16>;
+    using VectorType = Conditional<sizeof(HaystackType) == 1, SIMD::u8x16, SIMD::u16x8>;
+    static constexpr size_t lanes = SIMD::vector_length<VectorType>;
+
+    auto const* data = reinterpret_cast<CodeUnit const*>(haystack.data());
+    auto needle_length = needle.size();
+    auto last_offset = haystack.size() - needle_length;
+
+    auto first = static_cast<CodeUnit>(needle.first());
+    auto last = static_cast<CodeUnit>(needle.last());
+
+    auto matches_at = [&](size_t offset) {
+        if constexpr (IsSame<HaystackType, NeedleType>) {
+            return TypedTransfer<HaystackType>::compare(haystack.data() + offset + 1, needle.data() + 1, needle_length - 1);
+        } else {
+            for (size_t i = 1; i < needle_length - 1; ++i) {
+                if (static_cast<char16_t>(haystack[offset + i]) != static_cast<char16_t>(needle[i]))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    auto scalar_match_at = [&](size_t offset) {
+        return data[offset] == first && data[offset + needle_length - 1] == last && matches_at(offset);
+    };
+
+    VectorType first_vector {};
+    first_vector += first;
+    VectorType last_vector {};
+    last_vector += last;
+
+    auto candidates_at = [&](size_t offset) {
+        auto first_block = SIMD::load_unaligned<VectorType>(data + offset);
+        auto last_block = SIMD::load_unaligned<VectorType>(data + offset + needle_length - 1);
+        return (first_block == first_vector) & (last_block == last_vector);
+    };
+
+    auto has_candidates = [](auto mask) {
+        auto words = bit_cast<SIMD::u64x2>(mask);
+        return (words[0] | words[1]) != 0;
+    };
+
+    if constexpr (direction == SearchDirection::Forward) {
+        auto offset = start_offset;
+
+        for (; offset + lanes <= last_offset + 1; offset += lanes) {
+            auto mask = candidates_at(offset);
+            if (!has_candidates(mask))
+                continue;
+
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                if (mask[lane] && matches_at(offset + lane))
+                    return offset + lane;
+            }
+        }
+
+        for (; offset <= last_offset; ++offset) {
+            if (scalar_match_at(offset))
+                return offset;
+        }
+    } else {
+        auto end = min(start_offset, last_offset) + 1;
+
+        for (; end >= lanes; end -= lanes) {
+            auto offset = end - lanes;
+
+            auto mask = candidates_at(offset);
+            if (!has_candidates(mask))
+                continue;
+
+            for (size_t lane = lanes; lane > 0; --lane) {
+                if (mask[lane - 1] && matches_at(offset + lane - 1))
+                    return offset + lane - 1;
+            }
+        }
+
+        for (; end > 0; --end) {
+            if (scalar_match_at(end - 1))
+                return end - 1;
+        }
+    }
+
+    return {};
+}
+
+template<SearchDirection direction>
+static Optional<size_t> find_substring_offset(Utf16View const& haystack, Utf16View const& needle, size_t start_offset)
+{
+    if (haystack.has_ascii_storage()) {
+        if (needle.has_ascii_storage())
+            return find_substring_offset<direction>(haystack.ascii_span(), needle.ascii_span(), start_offset);
+
+        // An ASCII haystack can only ever contain a needle that consists solely of ASCII code units.
+        if (!needle.is_ascii())
+            return {};
+        return find_substring_offset<direction>(haystack.ascii_span(), needle.utf16_span(), start_offset);
+    }
+
+    if (needle.has_ascii_storage())
+        return find_substring_offset<direction>(haystack.utf16_span(), needle.ascii_span(), start_offset);
+    return find_substring_offset<direction>(haystack.utf16_span(), needle.utf16_span(), start_offset);
+}
+
+Optional<size_t> Utf16View::find_code_unit_offset(Utf16View const& needle, size_t start_offset) const
+{
+    Checked maximum_offset { start_offset };
+    maximum_offset += needle.length_in_code_units();
+    if (maximum_offset.has_overflow() || maximum_offset.value() > length_in_code_units())
+        return {};
+
+    if (needle.is_empty())
+        return start_offset;
+    if (needle.length_in_code_units() == 1)
+        return find_code_unit_offset(needle.code_unit_at(0), start_offset);
+
+    return find_substring_offset<SearchDirection::Forward>(*this, needle, start_offset);
+}
+
+Optional<size_t> Utf16View::find_last_code_unit_offset(Utf16View const& needle, size_t start_offset) const
+{
+    if (needle.length_in_code_units() > length_in_code_units())
+        return {};
+
+    if (needle.is_empty())
+        return min(start_offset, length_in_code_units());
+
+    return find_substring_offset<SearchDirection::Backward>(*this, needle, start_offset);
+}
+
 Optional<size_t> Utf16View::find_code_unit_offset(char16_t needle, size_t start_offset) const
 {
     if (start_offset >= length_in_code_units())
@@ -486,31 +486,10 @@ public:
 
     Optional<size_t> find_code_unit_offset(char16_t needle, size_t start_offset = 0) const;
 
-    constexpr Optional<size_t> find_code_unit_offset(Utf16View const& needle, size_t start_offset = 0) const
-    {
-        if (has_ascii_storage() && needle.has_ascii_storage())
-            return ascii_span().index_of(needle.ascii_span(), start_offset);
-        if (!has_ascii_storage() && !needle.has_ascii_storage())
-            return utf16_span().index_of(needle.utf16_span(), start_offset);
-
-        Checked maximum_offset { start_offset };
-        maximum_offset += needle.length_in_code_units();
-        if (maximum_offset.has_overflow() || maximum_offset.value() > length_in_code_units())
-            return {};
-
-        if (needle.is_empty())
-            return start_offset;
-
-        for (size_t index = start_offset; index <= length_in_code_units() - needle.length_in_code_units();) {
-            auto slice = substring_view(index, needle.length_in_code_units());
-            if (slice == needle)
-                return index;
-
-            index += slice.begin().length_in_code_units();
-        }
-
-        return {};
-    }
+    // These consider every code unit offset as a potential match, including offsets that fall between the two halves
+    // of a surrogate pair. find_last_code_unit_offset returns the last match that begins at or before start_offset.
+    Optional<size_t> find_code_unit_offset(Utf16View const& needle, size_t start_offset = 0) const;
+    Optional<size_t> find_last_code_unit_offset(Utf16View const& needle, size_t start_offset) const;
 
     constexpr Optional<size_t> find_code_unit_offset_ignoring_case(Utf16View const& needle, size_t start_offset = 0) const
     {
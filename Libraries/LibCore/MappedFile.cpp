@@ -60,6 +60,21 @@ MappedFile::MappedFile(void* ptr, size_t size, Mode mode)
 {
 }
 
+void MappedFile::advise_will_need(ReadonlyBytes range) const
+{
+    if (range.is_empty())
+        return;
+    auto start = reinterpret_cast<FlatPtr>(range.data());
+    auto end = start + range.size();
+    VERIFY(start >= reinterpret_cast<FlatPtr>(m_data) && end <= reinterpret_cast<FlatPtr>(m_data) + m_size);
+
+#if defined(POSIX_MADV_WILLNEED)
+    // The address passed to madvise() must be page-aligned.
+    auto aligned_start = start - (start % PAGE_SIZE);
+    (void)posix_madvise(reinterpret_cast<void*>(aligned_start), end - aligned_start, POSIX_MADV_WILLNEED);
+#endif
+}
+
 MappedFile::~MappedFile()
 {
     auto res = Core::System::munmap(m_data, m_size);
@@ -32,6 +32,10 @@ public:
     void const* data() const { return m_data; }
     ReadonlyBytes bytes() const LIFETIME_BOUND { return { m_data, m_size }; }
 
+    // Hints to the kernel that the given part of the mapping will be read soon, so that it can be paged in ahead of
+    // time instead of faulting in one page at a time.
+    void advise_will_need(ReadonlyBytes) const;
+
 private:
     explicit MappedFile(void*, size_t, Mode);
 
@@ -49,6 +53,8 @@ public:
     MappedFile const& operator->() const { return *m_file; }
     MappedFile& operator->() { return *m_file; }
 
+    MappedFile const& file() const { return *m_file; }
+
 private:
     NonnullOwnPtr<MappedFile> m_file;
 };
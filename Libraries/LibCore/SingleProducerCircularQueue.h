@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/Error.h>
+#include <AK/Noncopyable.h>
+#include <AK/NumericLimits.h>
+#include <AK/Platform.h>
+
+namespace Core {
+
+// A circular lock-free queue with a single producer, living in the memory of the current process.
+// This follows the same algorithm as SharedSingleProducerCircularQueue, but stores its elements inline, which means
+// that it can hold types that aren't trivially copyable, and that it must not be moved while it is in use.
+// Enqueueing is wait-free. Dequeueing is lock-free and may happen from multiple threads. The producer can have the
+// elements it has enqueued so far discarded by the next dequeue, so that it never has to contend with the consumers.
+template<typename T, size_t Size = 32>
+// Size must be a power of two, which speeds up the modulus operations for indexing.
+requires(popcount(Size) == 1)
+class SingleProducerCircularQueue final {
+    AK_MAKE_NONCOPYABLE(SingleProducerCircularQueue);
+    AK_MAKE_NONMOVABLE(SingleProducerCircularQueue);
+
+public:
+    using ValueType = T;
+
+    enum class QueueStatus : u8 {
+        Invalid = 0,
+        Full,
+        Empty,
+    };
+
+    SingleProducerCircularQueue() = default;
+
+    constexpr size_t size() const { return Size; }
+    // These functions are provably inconsistent and should only be used as hints to the actual capacity and used count.
+    // The producer can rely on weak_used() never being lower than the actual used count, since only it adds elements.
+    ALWAYS_INLINE size_t weak_remaining_capacity() const { return Size - weak_used(); }
+    ALWAYS_INLINE size_t weak_used() const
+    {
+        // Load the head first, so that a concurrent enqueue and dequeue can't make it overtake the tail we see.
+        auto current_head = head();
+        return m_tail.load() - current_head;
+    }
+    ALWAYS_INLINE bool weak_is_empty() const { return weak_used() == 0; }
+
+    // Must only be called by the producer.
+    ErrorOr<void, QueueStatus> enqueue(ValueType to_insert)
+    {
+        if (!can_enqueue())
+            return QueueStatus::Full;
+        auto our_tail = m_tail.load() % Size;
+        m_data[our_tail] = move(to_insert);
+        m_tail.fetch_add(1);
+
+        return {};
+    }
+
+    ALWAYS_INLINE bool can_enqueue() const
+    {
+        return m_tail.load() - head() < Size;
+    }
+
+    ErrorOr<ValueType, QueueStatus> dequeue()
+    {
+        while (true) {
+            // This CAS only succeeds if nobody is currently dequeuing.
+            auto size_max = NumericLimits<size_t>::max();
+            if (m_head_protector.compare_exchange_strong(size_max, m_head.load())) {
+                auto old_head = m_head.load();
+                // Destroy the elements that the producer asked to be discarded. Since the producer only ever marks
+                // elements that it has already enqueued, they are all present.
+                for (auto discard_until = m_discard_until.load(); old_head < discard_until; ++old_head) {
+                    m_data[old_head % Size] = ValueType {};
+                    m_head.fetch_add(1);
+                }
+                // This check has to happen while we hold the protector, since another dequeuer might have taken the
+                // last element in the meantime.
+                if (old_head >= m_tail.load()) {
+                    m_head_protector.store(NumericLimits<size_t>::max(), AK::MemoryOrder::memory_order_release);
+                    return QueueStatus::Empty;
+                }
+                auto data = move(m_data[old_head % Size]);
+                m_head.fetch_add(1);
+                m_head_protector.store(NumericLimits<size_t>::max(), AK::MemoryOrder::memory_order_release);
+                return { move(data) };
+            }
+        }
+    }
+
+    // Must only be called by the producer. Every element that has been enqueued so far is destroyed by the next
+    // dequeue instead of being returned. Until then, they still take up space in the queue.
+    void discard_enqueued()
+    {
+        m_discard_until.store(m_tail.load());
+    }
+
+    // The "real" head as seen by the outside world. Don't use m_head directly unless you know what you're doing.
+    size_t head() const
+    {
+        return min(m_head.load(), m_head_protector.load());
+    }
+
+private:
+    // The same invariants as in SharedSingleProducerCircularQueue apply here, except that a full queue is signalled
+    // with tail - head = Size, so that all slots can be used. The slot a dequeuer is moving out of is still counted
+    // as used until the protector has been released.
+    AK_CACHE_ALIGNED Atomic<size_t, AK::MemoryOrder::memory_order_seq_cst> m_tail { 0 };
+    AK_CACHE_ALIGNED Atomic<size_t, AK::MemoryOrder::memory_order_seq_cst> m_head { 0 };
+    AK_CACHE_ALIGNED Atomic<size_t, AK::MemoryOrder::memory_order_seq_cst> m_head_protector { NumericLimits<size_t>::max() };
+    // Elements before this index are destroyed when dequeueing. It's only written by the producer.
+    Atomic<size_t, AK::MemoryOrder::memory_order_seq_cst> m_discard_until { 0 };
+
+    Array<ValueType, Size> m_data;
+};
+
+}
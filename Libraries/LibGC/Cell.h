@@ -152,6 +152,10 @@ public:
 
         void visit(NanBoxedValue const& value) SWIFT_NAME(visitValue(_:));
 
+        // Visits an ephemeron edge: value is only kept alive for as long as key is reachable through some other path.
+        // Visitors that don't care about reachability treat this as a plain edge to value.
+        virtual void visit_ephemeron(Cell& key, NanBoxedValue const& value);
+
         // Allow explicitly ignoring a GC-allocated member in a visit_edges implementation instead
         // of just not using it.
         template<typename T>
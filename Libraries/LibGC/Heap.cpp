@@ -418,16 +418,64 @@ public:
         });
     }
 
+    virtual void visit_ephemeron(Cell& key, NanBoxedValue const& value) override
+    {
+        if (key.is_marked() || is_surviving_unmarked_cell(key)) {
+            visit(value);
+            return;
+        }
+        if (!value.is_cell())
+            return;
+
+        // The key hasn't been reached (yet), so park the value until the key comes off the work queue.
+        // Every marked cell is dequeued exactly once, which keeps this linear in the number of ephemerons.
+        m_pending_ephemeron_values.ensure(&key).append(&value.as_cell());
+    }
+
     void mark_all_live_cells()
     {
         while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+            auto cell = m_work_queue.take_last();
+            visit_pending_ephemeron_values(*cell);
+            cell->visit_edges(*this);
+        }
+    }
+
+    // Cells that must survive garbage collection are kept alive without being marked. Their edges are traced like
+    // those of marked cells, and since they stay alive, so do the ephemeron values keyed on them.
+    void mark_cells_reachable_from_surviving_unmarked_cells(Vector<Cell&> const& cells)
+    {
+        for (auto& cell : cells)
+            m_surviving_unmarked_cells.set(&cell);
+
+        for (auto& cell : cells) {
+            visit_pending_ephemeron_values(cell);
+            cell.visit_edges(*this);
         }
+
+        mark_all_live_cells();
     }
 
 private:
+    void visit_pending_ephemeron_values(Cell& key)
+    {
+        if (m_pending_ephemeron_values.is_empty())
+            return;
+        if (auto values = m_pending_ephemeron_values.take(&key); values.has_value()) {
+            for (auto* value : *values)
+                visit(value);
+        }
+    }
+
+    bool is_surviving_unmarked_cell(Cell& cell) const
+    {
+        return !m_surviving_unmarked_cells.is_empty() && m_surviving_unmarked_cells.contains(&cell);
+    }
+
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
+    HashMap<Cell*, Vector<Cell*, 1>> m_pending_ephemeron_values;
+    HashTable<Cell*> m_surviving_unmarked_cells;
     HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
@@ -441,17 +489,23 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
 
     visitor.mark_all_live_cells();
 
+    // NOTE: Uprooted cells are unmarked before looking for cells that must survive, so that an uprooted cell which
+    //       must survive is treated like any other such cell, including as the key of ephemerons.
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
 
+    Vector<Cell&> surviving_unmarked_cells;
     for_each_block([&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
-                cell->visit_edges(visitor);
+                surviving_unmarked_cells.append(*cell);
         });
         return IterationDecision::Continue;
     });
 
+    // Anything reached from the cells above still needs its own edges (and any ephemerons keyed on it) traced.
+    visitor.mark_cells_reachable_from_surviving_unmarked_cells(surviving_unmarked_cells);
+
     m_uprooted_cells.clear();
 }
 
@@ -11,10 +11,12 @@ namespace Gfx {
 void FontCascadeList::add(NonnullRefPtr<Font const> font)
 {
     m_fonts.append({ move(font), {} });
+    m_fallback_font_cache.clear();
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> unicode_ranges)
 {
+    m_fallback_font_cache.clear();
     if (unicode_ranges.is_empty()) {
         m_fonts.append({ move(font), {} });
         return;
@@ -37,23 +39,41 @@ void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> u
 void FontCascadeList::extend(FontCascadeList const& other)
 {
     m_fonts.extend(other.m_fonts);
+    m_fallback_font_cache.clear();
+}
+
+bool FontCascadeList::entry_contains_glyph(Entry const& entry, u32 code_point)
+{
+    if (entry.range_data.has_value()) {
+        if (!entry.range_data->enclosing_range.contains(code_point))
+            return false;
+        for (auto const& range : entry.range_data->unicode_ranges) {
+            if (range.contains(code_point) && entry.font->contains_glyph(code_point))
+                return true;
+        }
+        return false;
+    }
+    return entry.font->contains_glyph(code_point);
 }
 
 Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
 {
-    for (auto const& entry : m_fonts) {
-        if (entry.range_data.has_value()) {
-            if (!entry.range_data->enclosing_range.contains(code_point))
-                continue;
-            for (auto const& range : entry.range_data->unicode_ranges) {
-                if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
-            }
-        } else if (entry.font->contains_glyph(code_point)) {
-            return entry.font;
+    // OPTIMIZATION: Most text is covered by the first font, which is cheaper to check than the cache.
+    if (!m_fonts.is_empty() && entry_contains_glyph(m_fonts.first(), code_point))
+        return m_fonts.first().font;
+
+    if (auto it = m_fallback_font_cache.find(code_point); it != m_fallback_font_cache.end())
+        return *it->value;
+
+    Font const* font = m_last_resort_font.ptr();
+    for (size_t i = 1; i < m_fonts.size(); ++i) {
+        if (entry_contains_glyph(m_fonts[i], code_point)) {
+            font = m_fonts[i].font.ptr();
+            break;
         }
     }
-    return *m_last_resort_font;
+    m_fallback_font_cache.set(code_point, font);
+    return *font;
 }
 
 bool FontCascadeList::equals(FontCascadeList const& other) const
@@ -67,4 +87,27 @@ bool FontCascadeList::equals(FontCascadeList const& other) const
     return true;
 }
 
+bool FontCascadeList::is_identical_to(FontCascadeList const& other) const
+{
+    if (m_last_resort_font != other.m_last_resort_font || m_fonts.size() != other.m_fonts.size())
+        return false;
+    for (size_t i = 0; i < m_fonts.size(); ++i) {
+        auto const& entry = m_fonts[i];
+        auto const& other_entry = other.m_fonts[i];
+        if (entry.font != other_entry.font || entry.range_data.has_value() != other_entry.range_data.has_value())
+            return false;
+        if (entry.range_data.has_value() && entry.range_data->unicode_ranges != other_entry.range_data->unicode_ranges)
+            return false;
+    }
+    return true;
+}
+
+unsigned FontCascadeList::hash() const
+{
+    auto hash = ptr_hash(m_last_resort_font.ptr());
+    for (auto const& entry : m_fonts)
+        hash = pair_int_hash(hash, ptr_hash(entry.font.ptr()));
+    return hash;
+}
+
 }
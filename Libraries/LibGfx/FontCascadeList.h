@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -38,6 +39,11 @@ public:
 
     bool equals(FontCascadeList const& other) const;
 
+    // Unlike equals(), this also compares the Unicode ranges and the last-resort font, so that one of the lists can be
+    // used in place of the other.
+    bool is_identical_to(FontCascadeList const& other) const;
+    unsigned hash() const;
+
     struct Entry {
         NonnullRefPtr<Font const> font;
         struct RangeData {
@@ -49,7 +55,11 @@ public:
         Optional<RangeData> range_data;
     };
 
-    void set_last_resort_font(NonnullRefPtr<Font> font) { m_last_resort_font = move(font); }
+    void set_last_resort_font(NonnullRefPtr<Font> font)
+    {
+        m_last_resort_font = move(font);
+        m_fallback_font_cache.clear();
+    }
 
     Font const& first_text_face() const
     {
@@ -60,8 +70,15 @@ public:
     }
 
 private:
+    static bool entry_contains_glyph(Entry const&, u32 code_point);
+
     RefPtr<Font const> m_last_resort_font;
     Vector<Entry> m_fonts;
+
+    // Code points missing from the first font are looked up in every following font until one has them, which would
+    // otherwise be repeated for each occurrence in each text run. The fonts found are cached here, including the
+    // last-resort font for code points that no font in the list has a glyph for.
+    mutable HashMap<u32, Font const*> m_fallback_font_cache;
 };
 
 }
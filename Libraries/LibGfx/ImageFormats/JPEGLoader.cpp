@@ -6,6 +6,7 @@
 
 #include <LibGfx/CMYKBitmap.h>
 #include <LibGfx/ImageFormats/JPEGLoader.h>
+#include <LibGfx/PixelConversion.h>
 #include <jpeglib.h>
 #include <setjmp.h>
 
@@ -117,55 +118,16 @@ ErrorOr<void> JPEGLoadingContext::decode()
 
         // If image is in YCCK color space, we convert it to CMYK
         // and then CMYK code path will handle the rest
-        if (cinfo.out_color_space == JCS_YCCK) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = cmyk_bitmap->scanline(i)[j];
-
-                    auto y = cmyk.c;
-                    auto cb = cmyk.m;
-                    auto cr = cmyk.y;
-                    auto k = cmyk.k;
-
-                    int r = y + 1.402f * (cr - 128);
-                    int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
-                    int b = y + 1.772f * (cb - 128);
-
-                    y = clamp(r, 0, 255);
-                    cb = clamp(g, 0, 255);
-                    cr = clamp(b, 0, 255);
-                    k = 255 - k;
-
-                    cmyk_bitmap->scanline(i)[j] = {
-                        y,
-                        cb,
-                        cr,
-                        k,
-                    };
-                }
-            }
-        }
+        if (cinfo.out_color_space == JCS_YCCK)
+            PixelConversion::convert_ycck_to_cmyk({ cmyk_bitmap->begin(), cmyk_bitmap->data_size() / sizeof(CMYK) });
 
         // Photoshop writes inverted CMYK data (i.e. Photoshop's 0 should be 255). We convert this
         // to expected values.
         bool should_invert_cmyk = cinfo.jpeg_color_space == JCS_CMYK
             && (!cinfo.saw_Adobe_marker || cinfo.Adobe_transform == 0);
 
-        if (should_invert_cmyk) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                auto* line = cmyk_bitmap->scanline(i);
-
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = line[j];
-                    line[j] = {
-                        static_cast<u8>(255 - cmyk.c),
-                        static_cast<u8>(255 - cmyk.m),
-                        static_cast<u8>(255 - cmyk.y),
-                        static_cast<u8>(255 - cmyk.k),
-                    };
-                }
-            }
-        }
+        if (should_invert_cmyk)
+            PixelConversion::invert_cmyk({ cmyk_bitmap->begin(), cmyk_bitmap->data_size() / sizeof(CMYK) });
     }
 
     JOCTET* icc_data_ptr = nullptr;
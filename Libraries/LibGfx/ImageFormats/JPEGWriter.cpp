@@ -48,6 +48,13 @@ struct MemoryDestinationManager : public jpeg_destination_mgr {
 
 ErrorOr<void> JPEGWriter::encode_impl(Stream& stream, auto const& bitmap, Options const& options, ColorSpace color_space)
 {
+    // OPTIMIZATION: Handing libjpeg all rows in a single call lets it color convert and downsample whole MCU rows with
+    //               its SIMD code, instead of going through its per-call bookkeeping once for every row.
+    Vector<JSAMPROW> row_pointers;
+    TRY(row_pointers.try_ensure_capacity(bitmap.size().height()));
+    for (int y = 0; y < bitmap.size().height(); ++y)
+        row_pointers.unchecked_append(const_cast<JSAMPROW>(reinterpret_cast<u8 const*>(bitmap.scanline(y))));
+
     struct jpeg_compress_struct cinfo {};
     struct jpeg_error_mgr jerr {};
 
@@ -78,20 +85,29 @@ ErrorOr<void> JPEGWriter::encode_impl(Stream& stream, auto const& bitmap, Option
     jpeg_set_colorspace(&cinfo, JCS_YCbCr);
     jpeg_set_quality(&cinfo, options.quality, TRUE);
 
+    // The sampling factors of the luma component are relative to the chroma components, which are left at 1x1.
+    switch (options.chroma_subsampling) {
+    case JPEGChromaSubsampling::Yuv444:
+        cinfo.comp_info[0].h_samp_factor = 1;
+        cinfo.comp_info[0].v_samp_factor = 1;
+        break;
+    case JPEGChromaSubsampling::Yuv422:
+        cinfo.comp_info[0].h_samp_factor = 2;
+        cinfo.comp_info[0].v_samp_factor = 1;
+        break;
+    case JPEGChromaSubsampling::Yuv420:
+        cinfo.comp_info[0].h_samp_factor = 2;
+        cinfo.comp_info[0].v_samp_factor = 2;
+        break;
+    }
+
     if (options.icc_data.has_value()) {
         jpeg_write_icc_profile(&cinfo, options.icc_data->data(), options.icc_data->size());
     }
 
     jpeg_start_compress(&cinfo, TRUE);
-
-    Vector<JSAMPLE> row_buffer;
-    row_buffer.resize(bitmap.size().width() * 4);
-
-    while (cinfo.next_scanline < cinfo.image_height) {
-        auto const* row_ptr = reinterpret_cast<u8 const*>(bitmap.scanline(cinfo.next_scanline));
-        JSAMPROW row_pointer = const_cast<JSAMPROW>(row_ptr);
-        jpeg_write_scanlines(&cinfo, &row_pointer, 1);
-    }
+    while (cinfo.next_scanline < cinfo.image_height)
+        jpeg_write_scanlines(&cinfo, &row_pointers[cinfo.next_scanline], cinfo.image_height - cinfo.next_scanline);
 
     jpeg_finish_compress(&cinfo);
     jpeg_destroy_compress(&cinfo);
@@ -11,9 +11,20 @@
 
 namespace Gfx {
 
+enum class JPEGChromaSubsampling : u8 {
+    // Full resolution chroma, for the best color fidelity.
+    Yuv444,
+    // Chroma at half the horizontal resolution.
+    Yuv422,
+    // Chroma at half the horizontal and vertical resolution. This makes the smallest files, and is what most encoders
+    // use by default.
+    Yuv420,
+};
+
 struct JPEGEncoderOptions {
     Optional<ReadonlyBytes> icc_data;
     u8 quality { 75 };
+    JPEGChromaSubsampling chroma_subsampling { JPEGChromaSubsampling::Yuv420 };
 };
 
 class JPEGWriter {
@@ -4,12 +4,20 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/ByteBuffer.h>
+#include <AK/Endian.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
 #include <AK/Vector.h>
+#include <LibCompress/Zlib.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibGfx/PixelConversion.h>
+#include <LibThreading/Thread.h>
 #include <png.h>
+#include <zlib.h>
 
 namespace Gfx {
 
@@ -18,7 +26,34 @@ struct WriterContext {
     ByteBuffer png_data;
 };
 
-ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options)
+static constexpr size_t BYTES_PER_PIXEL = 4;
+
+// Strips smaller than this aren't worth the cost of starting a thread.
+static constexpr size_t MIN_ROWS_PER_STRIP = 64;
+
+// The largest distance that deflate can refer back to.
+static constexpr size_t DEFLATE_WINDOW_SIZE = 32 * KiB;
+
+static int png_filters_for_strategy(PNGFilterStrategy strategy)
+{
+    switch (strategy) {
+    case PNGFilterStrategy::Adaptive:
+        return PNG_ALL_FILTERS;
+    case PNGFilterStrategy::None:
+        return PNG_FILTER_NONE;
+    case PNGFilterStrategy::Sub:
+        return PNG_FILTER_SUB;
+    case PNGFilterStrategy::Up:
+        return PNG_FILTER_UP;
+    case PNGFilterStrategy::Average:
+        return PNG_FILTER_AVG;
+    case PNGFilterStrategy::Paeth:
+        return PNG_FILTER_PAETH;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static ErrorOr<ByteBuffer> encode_with_libpng(Gfx::Bitmap const& bitmap, PNGWriterOptions const& options)
 {
     auto context = make<WriterContext>();
     int width = bitmap.width();
@@ -48,6 +83,9 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
         png_set_bgr(png_ptr);
     }
 
+    png_set_compression_level(png_ptr, options.compression_level);
+    png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, png_filters_for_strategy(options.filter));
+
     png_set_write_fn(png_ptr, &context->png_data, [](png_structp png_ptr, u8* data, size_t length) {
         auto* buffer = reinterpret_cast<ByteBuffer*>(png_get_io_ptr(png_ptr));
         buffer->append(data, length); }, nullptr);
@@ -67,4 +105,334 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
     return context->png_data;
 }
 
+// https://www.w3.org/TR/png-3/#9Filter-types
+enum class FilterType : u8 {
+    None = 0,
+    Sub = 1,
+    Up = 2,
+    Average = 3,
+    Paeth = 4,
+};
+
+static void convert_row_to_rgba(Gfx::Bitmap const& bitmap, size_t y, Bytes destination)
+{
+    auto const* source = bitmap.scanline_u8(y);
+    if (bitmap.format() == BitmapFormat::BGRA8888 || bitmap.format() == BitmapFormat::BGRx8888) {
+        auto pixel_count = destination.size() / BYTES_PER_PIXEL;
+        PixelConversion::swap_red_and_blue({ reinterpret_cast<u32 const*>(source), pixel_count }, { reinterpret_cast<u32*>(destination.data()), pixel_count });
+        return;
+    }
+    memcpy(destination.data(), source, destination.size());
+}
+
+// https://www.w3.org/TR/png-3/#9Filter-type-4-Paeth
+static u8 paeth_predictor(u8 a, u8 b, u8 c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    if (pb <= pc)
+        return b;
+    return c;
+}
+
+// Writes the filter type, followed by the row filtered with that type.
+static void filter_row(FilterType type, ReadonlyBytes row, ReadonlyBytes previous_row, Bytes destination)
+{
+    destination[0] = to_underlying(type);
+    auto filtered = destination.slice(1);
+
+    for (size_t i = 0; i < row.size(); ++i) {
+        u8 a = i >= BYTES_PER_PIXEL ? row[i - BYTES_PER_PIXEL] : 0;
+        u8 b = previous_row[i];
+        u8 c = i >= BYTES_PER_PIXEL ? previous_row[i - BYTES_PER_PIXEL] : 0;
+
+        switch (type) {
+        case FilterType::None:
+            filtered[i] = row[i];
+            break;
+        case FilterType::Sub:
+            filtered[i] = row[i] - a;
+            break;
+        case FilterType::Up:
+            filtered[i] = row[i] - b;
+            break;
+        case FilterType::Average:
+            filtered[i] = row[i] - ((a + b) / 2);
+            break;
+        case FilterType::Paeth:
+            filtered[i] = row[i] - paeth_predictor(a, b, c);
+            break;
+        }
+    }
+}
+
+// https://www.w3.org/TR/png-3/#12Filter-selection
+// Uses the same heuristic as libpng, which is to pick the filter that minimizes the sum of the absolute values of the
+// filtered bytes when they are interpreted as signed.
+static void filter_row_adaptively(ReadonlyBytes row, ReadonlyBytes previous_row, Bytes destination, Bytes scratch)
+{
+    Optional<u64> best_sum;
+    for (auto type : { FilterType::None, FilterType::Sub, FilterType::Up, FilterType::Average, FilterType::Paeth }) {
+        filter_row(type, row, previous_row, scratch);
+
+        u64 sum = 0;
+        for (auto byte : scratch.slice(1))
+            sum += abs(static_cast<i8>(byte));
+
+        if (!best_sum.has_value() || sum < best_sum.value()) {
+            best_sum = sum;
+            scratch.copy_to(destination);
+        }
+    }
+}
+
+static void filter_row(PNGFilterStrategy strategy, ReadonlyBytes row, ReadonlyBytes previous_row, Bytes destination, Bytes scratch)
+{
+    switch (strategy) {
+    case PNGFilterStrategy::Adaptive:
+        filter_row_adaptively(row, previous_row, destination, scratch);
+        return;
+    case PNGFilterStrategy::None:
+        filter_row(FilterType::None, row, previous_row, destination);
+        return;
+    case PNGFilterStrategy::Sub:
+        filter_row(FilterType::Sub, row, previous_row, destination);
+        return;
+    case PNGFilterStrategy::Up:
+        filter_row(FilterType::Up, row, previous_row, destination);
+        return;
+    case PNGFilterStrategy::Average:
+        filter_row(FilterType::Average, row, previous_row, destination);
+        return;
+    case PNGFilterStrategy::Paeth:
+        filter_row(FilterType::Paeth, row, previous_row, destination);
+        return;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+struct Strip {
+    size_t first_row { 0 };
+    size_t row_count { 0 };
+
+    // Raw deflate data. Every strip but the last ends in a sync flush, so that the strips can be concatenated into a
+    // single deflate stream.
+    ByteBuffer compressed_data;
+    size_t uncompressed_size { 0 };
+    uLong adler32 { 1 };
+};
+
+static ErrorOr<void> compress_strip(Gfx::Bitmap const& bitmap, PNGWriterOptions const& options, Strip& strip, bool is_last_strip)
+{
+    auto row_size = static_cast<size_t>(bitmap.width()) * BYTES_PER_PIXEL;
+    auto filtered_row_size = row_size + 1;
+
+    // Deflate can refer back to data in the previous strip, so the end of it is filtered again to be used as the
+    // dictionary. This keeps the compression ratio close to that of a single stream.
+    auto dictionary_row_count = min(strip.first_row, ceil_div(DEFLATE_WINDOW_SIZE, filtered_row_size));
+    auto first_filtered_row = strip.first_row - dictionary_row_count;
+
+    auto filtered_data = TRY(ByteBuffer::create_uninitialized((dictionary_row_count + strip.row_count) * filtered_row_size));
+    auto previous_row = TRY(ByteBuffer::create_zeroed(row_size));
+    auto current_row = TRY(ByteBuffer::create_uninitialized(row_size));
+    auto scratch = TRY(ByteBuffer::create_uninitialized(filtered_row_size));
+
+    if (first_filtered_row > 0)
+        convert_row_to_rgba(bitmap, first_filtered_row - 1, previous_row.bytes());
+    for (size_t y = first_filtered_row; y < strip.first_row + strip.row_count; ++y) {
+        convert_row_to_rgba(bitmap, y, current_row.bytes());
+        auto destination = filtered_data.bytes().slice((y - first_filtered_row) * filtered_row_size, filtered_row_size);
+        filter_row(options.filter, current_row.bytes(), previous_row.bytes(), destination, scratch.bytes());
+        swap(previous_row, current_row);
+    }
+
+    auto dictionary = filtered_data.bytes().trim(dictionary_row_count * filtered_row_size);
+    if (dictionary.size() > DEFLATE_WINDOW_SIZE)
+        dictionary = dictionary.slice(dictionary.size() - DEFLATE_WINDOW_SIZE);
+    auto data = filtered_data.bytes().slice(dictionary_row_count * filtered_row_size);
+    if (data.size() > NumericLimits<uInt>::max())
+        return Error::from_string_literal("PNG strip is too large to compress");
+
+    strip.uncompressed_size = data.size();
+    strip.adler32 = adler32(adler32(0, nullptr, 0), data.data(), data.size());
+
+    z_stream stream {};
+    if (deflateInit2(&stream, options.compression_level, Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+        return Error::from_string_literal("Failed to initialize zlib for PNG encoding");
+    ScopeGuard end_stream = [&] { deflateEnd(&stream); };
+
+    if (!dictionary.is_empty() && deflateSetDictionary(&stream, dictionary.data(), dictionary.size()) != Z_OK)
+        return Error::from_string_literal("Failed to set the zlib dictionary for PNG encoding");
+
+    // The bound only accounts for finishing the stream, a sync flush adds an empty stored block of a few bytes.
+    strip.compressed_data = TRY(ByteBuffer::create_uninitialized(deflateBound(&stream, data.size()) + 16));
+    stream.next_in = const_cast<u8*>(data.data());
+    stream.avail_in = data.size();
+
+    auto flush = is_last_strip ? Z_FINISH : Z_SYNC_FLUSH;
+    size_t output_size = 0;
+    while (true) {
+        stream.next_out = strip.compressed_data.data() + output_size;
+        stream.avail_out = strip.compressed_data.size() - output_size;
+
+        auto result = deflate(&stream, flush);
+        output_size = strip.compressed_data.size() - stream.avail_out;
+        if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR)
+            return Error::from_string_literal("Failed to compress PNG image data");
+
+        if (result == Z_STREAM_END || (!is_last_strip && stream.avail_in == 0 && stream.avail_out != 0))
+            break;
+        if (stream.avail_out == 0)
+            TRY(strip.compressed_data.try_resize(strip.compressed_data.size() * 2));
+    }
+
+    strip.compressed_data.resize(output_size);
+    return {};
+}
+
+static ErrorOr<void> append_big_endian_u32(ByteBuffer& buffer, u32 value)
+{
+    BigEndian<u32> big_endian_value = value;
+    return buffer.try_append(&big_endian_value, sizeof(big_endian_value));
+}
+
+// https://www.w3.org/TR/png-3/#5Chunk-layout
+static ErrorOr<void> append_chunk(ByteBuffer& buffer, StringView type, std::initializer_list<ReadonlyBytes> data_parts)
+{
+    VERIFY(type.length() == 4);
+
+    size_t length = 0;
+    for (auto const& part : data_parts)
+        length += part.size();
+    if (length > NumericLimits<i32>::max())
+        return Error::from_string_literal("PNG chunk is too large");
+
+    TRY(append_big_endian_u32(buffer, length));
+    TRY(buffer.try_append(type.bytes()));
+    auto crc = crc32(crc32(0, nullptr, 0), type.bytes().data(), type.length());
+    for (auto const& part : data_parts) {
+        TRY(buffer.try_append(part));
+        crc = crc32(crc, part.data(), part.size());
+    }
+    TRY(append_big_endian_u32(buffer, crc));
+    return {};
+}
+
+// Filters and compresses horizontal strips of the image on separate threads, and joins the compressed strips into
+// a single zlib stream. Since that requires filtering the image ourselves, the PNG is written without libpng.
+static ErrorOr<ByteBuffer> encode_in_parallel(Gfx::Bitmap const& bitmap, PNGWriterOptions const& options)
+{
+    auto height = static_cast<size_t>(bitmap.height());
+    auto strip_count = min(options.thread_count, height / MIN_ROWS_PER_STRIP);
+    VERIFY(strip_count > 1);
+
+    Vector<Strip> strips;
+    TRY(strips.try_resize(strip_count));
+    Vector<Optional<Error>> strip_errors;
+    TRY(strip_errors.try_resize(strip_count));
+
+    auto rows_per_strip = ceil_div(height, strip_count);
+    for (size_t i = 0; i < strip_count; ++i) {
+        strips[i].first_row = min(i * rows_per_strip, height);
+        strips[i].row_count = min(rows_per_strip, height - strips[i].first_row);
+    }
+
+    auto compress_strip_at = [&](size_t index) {
+        if (auto result = compress_strip(bitmap, options, strips[index], index == strip_count - 1); result.is_error())
+            strip_errors[index] = result.release_error();
+    };
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 1; i < strip_count; ++i) {
+        auto thread = Threading::Thread::try_create([&compress_strip_at, i]() -> intptr_t {
+            compress_strip_at(i);
+            return 0;
+        },
+            "PNG Encoder"sv);
+
+        // If we can't start a thread, the strip can still be compressed on this one.
+        if (thread.is_error() || threads.try_append(thread.value()).is_error()) {
+            compress_strip_at(i);
+            continue;
+        }
+        thread.value()->start();
+    }
+
+    compress_strip_at(0);
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    for (auto& error : strip_errors) {
+        if (error.has_value())
+            return error.release_value();
+    }
+
+    ByteBuffer png_data;
+
+    // https://www.w3.org/TR/png-3/#5PNG-file-signature
+    static constexpr Array<u8, 8> png_signature { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    TRY(png_data.try_append(png_signature.span()));
+
+    // https://www.w3.org/TR/png-3/#11IHDR
+    ByteBuffer header;
+    TRY(append_big_endian_u32(header, bitmap.width()));
+    TRY(append_big_endian_u32(header, bitmap.height()));
+    // Bit depth 8, truecolor with alpha, deflate compression, adaptive filtering, no interlacing.
+    static constexpr Array<u8, 5> header_fields { 8, 6, 0, 0, 0 };
+    TRY(header.try_append(header_fields.span()));
+    TRY(append_chunk(png_data, "IHDR"sv, { header.bytes() }));
+
+    // https://www.w3.org/TR/png-3/#11iCCP
+    if (options.icc_data.has_value()) {
+        static constexpr auto profile_name = "embedded profile\0\0"sv;
+        auto compressed_profile = TRY(Compress::ZlibCompressor::compress_all(options.icc_data.value()));
+        TRY(append_chunk(png_data, "iCCP"sv, { profile_name.bytes(), compressed_profile.bytes() }));
+    }
+
+    // https://www.rfc-editor.org/rfc/rfc1950#section-2.2
+    // The zlib header announces a 32 KiB window, and a compression level that matches the one we used.
+    u8 compression_method_and_flags = 0x78;
+    u8 level_flags = 3;
+    if (options.compression_level < 2)
+        level_flags = 0;
+    else if (options.compression_level < 6)
+        level_flags = 1;
+    else if (options.compression_level == 6)
+        level_flags = 2;
+    u8 flags = level_flags << 6;
+    flags += 31 - (((compression_method_and_flags << 8) | flags) % 31);
+    Array<u8, 2> zlib_header { compression_method_and_flags, flags };
+
+    auto checksum = strips[0].adler32;
+    for (size_t i = 1; i < strip_count; ++i)
+        checksum = adler32_combine(checksum, strips[i].adler32, static_cast<z_off_t>(strips[i].uncompressed_size));
+    BigEndian<u32> zlib_trailer = static_cast<u32>(checksum);
+    ReadonlyBytes zlib_trailer_bytes { &zlib_trailer, sizeof(zlib_trailer) };
+
+    // https://www.w3.org/TR/png-3/#11IDAT
+    for (size_t i = 0; i < strip_count; ++i) {
+        auto prefix = i == 0 ? zlib_header.span() : ReadonlyBytes {};
+        auto suffix = i == strip_count - 1 ? zlib_trailer_bytes : ReadonlyBytes {};
+        TRY(append_chunk(png_data, "IDAT"sv, { prefix, strips[i].compressed_data.bytes(), suffix }));
+    }
+
+    // https://www.w3.org/TR/png-3/#11IEND
+    TRY(append_chunk(png_data, "IEND"sv, {}));
+
+    return png_data;
+}
+
+ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options)
+{
+    VERIFY(options.compression_level <= 9);
+
+    if (options.thread_count > 1 && static_cast<size_t>(bitmap.height()) >= 2 * MIN_ROWS_PER_STRIP)
+        return encode_in_parallel(bitmap, options);
+    return encode_with_libpng(bitmap, options);
+}
+
 }
@@ -13,11 +13,31 @@
 
 namespace Gfx {
 
+enum class PNGFilterStrategy : u8 {
+    // Picks the filter that is likely to compress best for each row.
+    Adaptive,
+    None,
+    Sub,
+    Up,
+    Average,
+    Paeth,
+};
+
 // This is not a nested struct to work around https://llvm.org/PR36684
 struct PNGWriterOptions {
     // Data for the iCCP chunk.
     // FIXME: Allow writing cICP, sRGB, or gAMA instead too.
     Optional<ReadonlyBytes> icc_data;
+
+    // The zlib compression level, from 0 (no compression) to 9 (smallest output). Level 1 is several times faster
+    // than the default, at the cost of somewhat larger files.
+    u8 compression_level { 6 };
+
+    PNGFilterStrategy filter { PNGFilterStrategy::Adaptive };
+
+    // If more than one, the image is split into horizontal strips that are filtered and compressed on separate
+    // threads, then joined into a single zlib stream. This makes the output slightly larger.
+    size_t thread_count { 1 };
 };
 
 class PNGWriter {
@@ -6,7 +6,9 @@
 
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibGfx/PixelConversion.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibThreading/Mutex.h>
 
 #include <core/SkBitmap.h>
 #include <core/SkCanvas.h>
@@ -28,11 +30,23 @@ StringView export_format_name(ExportFormat format)
     VERIFY_NOT_REACHED();
 }
 
+// Images with at least this many pixels get a chain of downscaled copies when they are drawn at a smaller size. For
+// smaller images, the mipmaps that Skia builds and caches on its own are good enough, but it won't keep those around
+// for images this large since they don't fit in its cache.
+static constexpr size_t MIN_PIXEL_COUNT_FOR_DOWNSCALED_LEVELS = 4096 * 4096;
+
 struct ImmutableBitmapImpl {
     sk_sp<SkImage> sk_image;
     SkBitmap sk_bitmap;
     Variant<NonnullRefPtr<Gfx::Bitmap>, NonnullRefPtr<Gfx::PaintingSurface>, Empty> source;
     ColorSpace color_space;
+
+    // A copy of sk_image that has been halved in size downscaled_image_level times. Only the copy that was last drawn
+    // is kept, which is at most a quarter of the size of sk_image. It's created on demand, from whichever thread draws
+    // the image.
+    Threading::Mutex downscaled_image_mutex;
+    sk_sp<SkImage> downscaled_image;
+    size_t downscaled_image_level { 0 };
 };
 
 int ImmutableBitmap::width() const
@@ -67,6 +81,74 @@ SkImage const* ImmutableBitmap::sk_image() const
     return m_impl->sk_image.get();
 }
 
+static sk_sp<SkImage> create_downscaled_level(SkImage const& image)
+{
+    auto info = image.imageInfo().makeWH(max(1, image.width() / 2), max(1, image.height() / 2));
+    SkBitmap bitmap;
+    if (!bitmap.tryAllocPixels(info))
+        return nullptr;
+
+    // Halving the size with bilinear filtering averages each 2x2 block of pixels.
+    if (!image.scalePixels(bitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear)))
+        return nullptr;
+
+    bitmap.setImmutable();
+    return bitmap.asImage();
+}
+
+template<>
+sk_sp<SkImage> ImmutableBitmap::sk_image_for_size(IntSize size) const
+{
+    auto const& image = m_impl->sk_image;
+    if (static_cast<size_t>(image->width()) * image->height() < MIN_PIXEL_COUNT_FOR_DOWNSCALED_LEVELS)
+        return image;
+
+    // Snapshots of painting surfaces may live on the GPU, and change too often to be worth downscaling.
+    if (!m_impl->source.has<NonnullRefPtr<Bitmap>>())
+        return image;
+
+    size_t level_count = 0;
+    auto level_width = image->width();
+    auto level_height = image->height();
+    while (level_width / 2 >= max(size.width(), 1) && level_height / 2 >= max(size.height(), 1)) {
+        level_width /= 2;
+        level_height /= 2;
+        ++level_count;
+    }
+    if (level_count == 0)
+        return image;
+
+    // Start from the cached copy if it's at least as large as the one we want, or from the full image otherwise.
+    sk_sp<SkImage> level = image;
+    size_t level_index = 0;
+    {
+        Threading::MutexLocker locker { m_impl->downscaled_image_mutex };
+        if (m_impl->downscaled_image && m_impl->downscaled_image_level <= level_count) {
+            level = m_impl->downscaled_image;
+            level_index = m_impl->downscaled_image_level;
+        }
+    }
+    if (level_index == level_count)
+        return level;
+
+    // NOTE: This is done without holding the lock, since scaling down the full image takes a while. Each intermediate
+    //       level is freed as soon as the next one has been created from it.
+    while (level_index < level_count) {
+        auto next_level = create_downscaled_level(*level);
+        if (!next_level)
+            break;
+        level = move(next_level);
+        ++level_index;
+    }
+    if (level_index == 0)
+        return image;
+
+    Threading::MutexLocker locker { m_impl->downscaled_image_mutex };
+    m_impl->downscaled_image = level;
+    m_impl->downscaled_image_level = level_index;
+    return level;
+}
+
 static int bytes_per_pixel_for_export_format(ExportFormat format)
 {
     switch (format) {
@@ -135,16 +217,15 @@ ErrorOr<BitmapExportResult> ImmutableBitmap::export_to_byte_buffer(ExportFormat
     if (width > 0 && height > 0) {
         if (format == ExportFormat::RGB888) {
             // 24 bit RGB is not supported by Skia, so we need to handle this format ourselves.
-            auto raw_buffer = buffer.data();
+            auto bgrx_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, alpha_type(), { width, height }));
+            auto bgrx_info = m_impl->sk_image->imageInfo().makeColorType(kBGRA_8888_SkColorType);
+            if (!m_impl->sk_image->readPixels(bgrx_info, bgrx_bitmap->begin(), bgrx_bitmap->pitch(), 0, 0))
+                return Error::from_string_literal("Gfx::ImmutableBitmap::export_to_byte_buffer failed to read pixels");
+
             for (auto y = 0; y < height; y++) {
                 auto target_y = flags & ExportFlags::FlipY ? height - y - 1 : y;
-                for (auto x = 0; x < width; x++) {
-                    auto pixel = get_pixel(x, y);
-                    auto buffer_offset = (target_y * buffer_pitch.value()) + (x * 3ull);
-                    raw_buffer[buffer_offset + 0] = pixel.red();
-                    raw_buffer[buffer_offset + 1] = pixel.green();
-                    raw_buffer[buffer_offset + 2] = pixel.blue();
-                }
+                auto row = buffer.bytes().slice(target_y * buffer_pitch.value(), buffer_pitch.value());
+                PixelConversion::convert_bgrx_to_rgb({ bgrx_bitmap->scanline(y), static_cast<size_t>(width) }, row);
             }
         } else {
             auto skia_format = export_format_to_skia_color_type(format);
@@ -200,14 +281,14 @@ static SkAlphaType to_skia_alpha_type(Gfx::AlphaType alpha_type)
 
 NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create(NonnullRefPtr<Bitmap> bitmap, ColorSpace color_space)
 {
-    ImmutableBitmapImpl impl;
+    auto impl = make<ImmutableBitmapImpl>();
     auto info = SkImageInfo::Make(bitmap->width(), bitmap->height(), to_skia_color_type(bitmap->format()), to_skia_alpha_type(bitmap->alpha_type()), color_space.color_space<sk_sp<SkColorSpace>>());
-    impl.sk_bitmap.installPixels(info, const_cast<void*>(static_cast<void const*>(bitmap->scanline(0))), bitmap->pitch());
-    impl.sk_bitmap.setImmutable();
-    impl.sk_image = impl.sk_bitmap.asImage();
-    impl.source = bitmap;
-    impl.color_space = move(color_space);
-    return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(impl)));
+    impl->sk_bitmap.installPixels(info, const_cast<void*>(static_cast<void const*>(bitmap->scanline(0))), bitmap->pitch());
+    impl->sk_bitmap.setImmutable();
+    impl->sk_image = impl->sk_bitmap.asImage();
+    impl->source = bitmap;
+    impl->color_space = move(color_space);
+    return adopt_ref(*new ImmutableBitmap(move(impl)));
 }
 
 NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create(NonnullRefPtr<Bitmap> bitmap, AlphaType alpha_type, ColorSpace color_space)
@@ -225,10 +306,10 @@ NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create(NonnullRefPtr<Bitmap> bit
 
 NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create_snapshot_from_painting_surface(NonnullRefPtr<PaintingSurface> painting_surface)
 {
-    ImmutableBitmapImpl impl;
-    impl.sk_image = painting_surface->sk_image_snapshot<sk_sp<SkImage>>();
-    impl.source = painting_surface;
-    return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(impl)));
+    auto impl = make<ImmutableBitmapImpl>();
+    impl->sk_image = painting_surface->sk_image_snapshot<sk_sp<SkImage>>();
+    impl->source = painting_surface;
+    return adopt_ref(*new ImmutableBitmap(move(impl)));
 }
 
 ImmutableBitmap::ImmutableBitmap(NonnullOwnPtr<ImmutableBitmapImpl> impl)
@@ -61,6 +61,13 @@ public:
     AlphaType alpha_type() const;
 
     SkImage const* sk_image() const;
+
+    // Returns the smallest downscaled copy of a very large image that is still at least the given size, or the image
+    // itself if there is none. Only the copy that was returned last is cached.
+    // In order to keep this file free of Skia types, this is a template that is only specialized for sk_sp<SkImage>.
+    template<typename T>
+    T sk_image_for_size(IntSize) const;
+
     [[nodiscard]] ErrorOr<BitmapExportResult> export_to_byte_buffer(ExportFormat format, int flags, Optional<int> target_width, Optional<int> target_height) const;
 
     Color get_pixel(int x, int y) const;
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibGfx/PixelConversion.h>
+
+// The vectors are twice as wide as an SSE register, which GCC warns about when passing them to the helpers below
+// without AVX enabled. All of them are inlined, so this doesn't matter.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace Gfx::PixelConversion {
+
+using AK::SIMD::f32x8;
+using AK::SIMD::i32x8;
+using AK::SIMD::u32x8;
+using AK::SIMD::u8x32;
+
+// Eight pixels fill an AVX2 register, and two SSE or NEON registers.
+static constexpr size_t PIXELS_PER_VECTOR = AK::SIMD::vector_length<u32x8>;
+
+// Divides values of up to 255 * 255 by 255, rounding down.
+static ALWAYS_INLINE u32x8 divide_by_255(u32x8 value)
+{
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+static ALWAYS_INLINE u32x8 clamp_to_u8(i32x8 value)
+{
+    value &= ~(value < 0);
+    auto is_above = value > 255;
+    return __builtin_convertvector((value & ~is_above) | (is_above & 255), u32x8);
+}
+
+template<typename Kernel>
+static ALWAYS_INLINE void convert_pixels(ReadonlySpan<u32> source, Span<u32> destination, Kernel kernel)
+{
+    VERIFY(source.size() == destination.size());
+
+    size_t i = 0;
+    for (; i + PIXELS_PER_VECTOR <= source.size(); i += PIXELS_PER_VECTOR)
+        AK::SIMD::store_unaligned(&destination[i], kernel(AK::SIMD::load_unaligned<u32x8>(&source[i])));
+
+    auto remaining = source.size() - i;
+    if (remaining == 0)
+        return;
+    u32x8 tail {};
+    __builtin_memcpy(&tail, &source[i], remaining * sizeof(u32));
+    tail = kernel(tail);
+    __builtin_memcpy(&destination[i], &tail, remaining * sizeof(u32));
+}
+
+static ReadonlySpan<u32> as_pixels(ReadonlySpan<CMYK> pixels)
+{
+    static_assert(sizeof(CMYK) == sizeof(u32));
+    return { reinterpret_cast<u32 const*>(pixels.data()), pixels.size() };
+}
+
+static Span<u32> as_pixels(Span<CMYK> pixels)
+{
+    return { reinterpret_cast<u32*>(pixels.data()), pixels.size() };
+}
+
+void swap_red_and_blue(ReadonlySpan<u32> source, Span<u32> destination)
+{
+    convert_pixels(source, destination, [](u32x8 pixels) {
+        return (pixels & 0xff00ff00) | ((pixels >> 16) & 0xff) | ((pixels & 0xff) << 16);
+    });
+}
+
+void premultiply_alpha(ReadonlySpan<u32> source, Span<u32> destination)
+{
+    convert_pixels(source, destination, [](u32x8 pixels) {
+        auto alpha = pixels >> 24;
+
+        // The red and blue channels are multiplied together as two 16-bit lanes of each pixel. Adding 128 and then
+        // the high byte before shifting right by 8 divides by 255 with rounding.
+        auto red_and_blue = ((pixels & 0x00ff00ff) * alpha) + 0x00800080;
+        red_and_blue = ((red_and_blue + ((red_and_blue >> 8) & 0x00ff00ff)) >> 8) & 0x00ff00ff;
+
+        auto green = (((pixels >> 8) & 0xff) * alpha) + 0x80;
+        green = ((green + (green >> 8)) >> 8) & 0xff;
+
+        return (alpha << 24) | (green << 8) | red_and_blue;
+    });
+}
+
+void unpremultiply_alpha(ReadonlySpan<u32> source, Span<u32> destination)
+{
+    convert_pixels(source, destination, [](u32x8 pixels) {
+        auto alpha = pixels >> 24;
+        auto is_transparent = bit_cast<u32x8>(alpha == 0);
+
+        // Each channel becomes round(channel * 255 / alpha), computed as (channel * 510 + alpha) / (alpha * 2).
+        // There is no vector integer division, so the quotient is estimated with a float reciprocal and then
+        // corrected by one in either direction, which makes the result exact. Fully transparent pixels are divided
+        // by two instead, and cleared below.
+        auto denominator = (alpha | (is_transparent & 1)) * 2;
+        auto reciprocal = 1.0f / __builtin_convertvector(denominator, f32x8);
+        auto unpremultiply_channel = [&](u32 shift) {
+            auto numerator = (((pixels >> shift) & 0xff) * 510) + alpha;
+            auto quotient = __builtin_convertvector(__builtin_convertvector(numerator, f32x8) * reciprocal, u32x8);
+            quotient += bit_cast<u32x8>(quotient * denominator > numerator);
+            quotient -= bit_cast<u32x8>((quotient + 1) * denominator <= numerator);
+
+            // Channels larger than the alpha aren't valid premultiplied colors, but can still occur.
+            auto is_above = bit_cast<u32x8>(quotient > 255);
+            return ((quotient & ~is_above) | (is_above & 255)) << shift;
+        };
+
+        auto result = (alpha << 24) | unpremultiply_channel(16) | unpremultiply_channel(8) | unpremultiply_channel(0);
+        return result & ~is_transparent;
+    });
+}
+
+void convert_bgrx_to_rgb(ReadonlySpan<u32> source, Bytes destination)
+{
+    VERIFY(destination.size() == source.size() * 3);
+
+    auto pack = [](u32x8 pixels) {
+        auto bytes = bit_cast<u8x32>(pixels);
+        return __builtin_shufflevector(bytes, bytes,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 18, 17, 16, 22, 21, 20, 26, 25, 24, 30, 29, 28,
+            3, 7, 11, 15, 19, 23, 27, 31);
+    };
+
+    size_t i = 0;
+    for (; i + PIXELS_PER_VECTOR <= source.size(); i += PIXELS_PER_VECTOR) {
+        auto packed = pack(AK::SIMD::load_unaligned<u32x8>(&source[i]));
+        __builtin_memcpy(&destination[i * 3], &packed, PIXELS_PER_VECTOR * 3);
+    }
+
+    auto remaining = source.size() - i;
+    if (remaining == 0)
+        return;
+    u32x8 tail {};
+    __builtin_memcpy(&tail, &source[i], remaining * sizeof(u32));
+    auto packed = pack(tail);
+    __builtin_memcpy(&destination[i * 3], &packed, remaining * 3);
+}
+
+void convert_cmyk_to_bgrx(ReadonlySpan<CMYK> source, Span<u32> destination)
+{
+    convert_pixels(as_pixels(source), destination, [](u32x8 pixels) {
+        auto inverted = ~pixels;
+        auto inverted_black = inverted >> 24;
+
+        auto red = divide_by_255((inverted & 0xff) * inverted_black);
+        auto green = divide_by_255(((inverted >> 8) & 0xff) * inverted_black);
+        auto blue = divide_by_255(((inverted >> 16) & 0xff) * inverted_black);
+
+        return 0xff000000 | (red << 16) | (green << 8) | blue;
+    });
+}
+
+void convert_ycck_to_cmyk(Span<CMYK> pixels)
+{
+    convert_pixels(as_pixels(pixels), as_pixels(pixels), [](u32x8 ycck) {
+        auto y = __builtin_convertvector(ycck & 0xff, f32x8);
+        auto cb = __builtin_convertvector((ycck >> 8) & 0xff, f32x8) - 128.0f;
+        auto cr = __builtin_convertvector((ycck >> 16) & 0xff, f32x8) - 128.0f;
+        auto k = ycck >> 24;
+
+        auto red = clamp_to_u8(__builtin_convertvector(y + (1.402f * cr), i32x8));
+        auto green = clamp_to_u8(__builtin_convertvector(y - (0.3441f * cb) - (0.7141f * cr), i32x8));
+        auto blue = clamp_to_u8(__builtin_convertvector(y + (1.772f * cb), i32x8));
+
+        return ((255 - k) << 24) | (blue << 16) | (green << 8) | red;
+    });
+}
+
+void invert_cmyk(Span<CMYK> pixels)
+{
+    convert_pixels(as_pixels(pixels), as_pixels(pixels), [](u32x8 cmyk) {
+        return ~cmyk;
+    });
+}
+
+}
+
+#pragma GCC diagnostic pop
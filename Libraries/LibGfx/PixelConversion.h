@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <AK/Types.h>
+#include <LibGfx/CMYKBitmap.h>
+
+// Bulk conversions between pixel formats, for converting whole scanlines or bitmaps at once.
+//
+// These are written with AK's SIMD vector types, so that the compiler can turn them into SSE, AVX or NEON code
+// depending on the target. Pixels that don't fill a whole vector go through the same vector code, which keeps the
+// results independent of where a pixel is in the span.
+//
+// Unless noted otherwise, the source and destination must have the same size, and may be the same span to convert
+// in place.
+namespace Gfx::PixelConversion {
+
+// Converts between BGRA8888 and RGBA8888 (and likewise for the x variants) by swapping the red and blue channels.
+void swap_red_and_blue(ReadonlySpan<u32> source, Span<u32> destination);
+
+// Multiplies the color channels of BGRA8888 or RGBA8888 pixels by their alpha, rounded to the nearest value.
+void premultiply_alpha(ReadonlySpan<u32> source, Span<u32> destination);
+
+// Divides the color channels of premultiplied BGRA8888 or RGBA8888 pixels by their alpha, rounded to the nearest
+// value. Fully transparent pixels become transparent black.
+void unpremultiply_alpha(ReadonlySpan<u32> source, Span<u32> destination);
+
+// Converts BGRx8888 or BGRA8888 pixels to packed 24-bit RGB, dropping the alpha channel. The destination must hold
+// three bytes per pixel, and must not overlap the source.
+void convert_bgrx_to_rgb(ReadonlySpan<u32> source, Bytes destination);
+
+// Converts CMYK pixels to opaque BGRx8888 pixels with the naive formula, without any color management.
+void convert_cmyk_to_bgrx(ReadonlySpan<CMYK> source, Span<u32> destination);
+
+// Converts YCCK pixels, as decoded from Adobe JPEGs, to CMYK in place.
+void convert_ycck_to_cmyk(Span<CMYK> pixels);
+
+// Inverts every channel of CMYK pixels in place.
+void invert_cmyk(Span<CMYK> pixels);
+
+}
@@ -1902,6 +1902,8 @@ public:
 private:
     virtual bool is_object_expression() const override { return true; }
 
+    Bytecode::CodeGenerationErrorOr<Optional<Bytecode::ScopedOperand>> try_generate_bytecode_from_template(Bytecode::Generator&, Optional<Bytecode::ScopedOperand> preferred_dst) const;
+
     Vector<NonnullRefPtr<ObjectProperty>> m_properties;
 };
 
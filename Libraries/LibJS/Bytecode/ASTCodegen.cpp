@@ -1140,13 +1140,62 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ForStatement::generate_
     return body_result;
 }
 
+Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::try_generate_bytecode_from_template(Bytecode::Generator& generator, Optional<ScopedOperand> preferred_dst) const
+{
+    static constexpr size_t max_template_property_count = 32;
+    if (m_properties.is_empty() || m_properties.size() > max_template_property_count)
+        return Optional<ScopedOperand> {};
+
+    HashTable<Utf16FlyString> seen_names;
+    for (auto& property : m_properties) {
+        if (property->type() != ObjectProperty::Type::KeyValue || property->is_method() || !is<StringLiteral>(property->key()))
+            return Optional<ScopedOperand> {};
+
+        // NOTE: Function and class values may need the object as their home object, or take their name from the key.
+        if (is<FunctionExpression>(property->value()) || is<ClassExpression>(property->value()))
+            return Optional<ScopedOperand> {};
+
+        Utf16FlyString name { static_cast<StringLiteral const&>(property->key()).value() };
+        if (PropertyKey { name }.is_number() || seen_names.set(name) != HashSetResult::InsertedNewEntry)
+            return Optional<ScopedOperand> {};
+    }
+
+    Vector<IdentifierTableIndex> property_names;
+    Vector<ScopedOperand> values;
+    property_names.ensure_capacity(m_properties.size());
+    values.ensure_capacity(m_properties.size());
+    for (auto& property : m_properties) {
+        property_names.append(generator.intern_identifier(static_cast<StringLiteral const&>(property->key()).value()));
+        auto value = TRY(property->value().generate_bytecode(generator)).value();
+        values.append(generator.copy_if_needed_to_preserve_evaluation_order(value));
+    }
+
+    auto object = choose_dst(generator, preferred_dst);
+    auto template_index = generator.add_object_literal_template(move(property_names));
+    generator.emit_with_extra_operand_slots<Bytecode::Op::NewObjectFromTemplate>(values.size(), object, template_index, values);
+    return object;
+}
+
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::generate_bytecode(Bytecode::Generator& generator, [[maybe_unused]] Optional<ScopedOperand> preferred_dst) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
 
+    // OPTIMIZATION: Literals made up only of plain `name: value` properties with distinct names are created in one go
+    //               from a template, which remembers the resulting shape across evaluations.
+    if (auto object = TRY(try_generate_bytecode_from_template(generator, preferred_dst)); object.has_value())
+        return object;
+
     auto object = choose_dst(generator, preferred_dst);
 
-    generator.emit<Bytecode::Op::NewObject>(object);
+    // OPTIMIZATION: The number of named properties this literal defines is known up front (short of spreads, which
+    //               are left out), so the object's property storage can be allocated once instead of growing.
+    u32 expected_property_count = 0;
+    for (auto& property : m_properties) {
+        if (property->type() != ObjectProperty::Type::Spread && property->type() != ObjectProperty::Type::ProtoSetter)
+            ++expected_property_count;
+    }
+
+    generator.emit<Bytecode::Op::NewObject>(object, expected_property_count);
     if (m_properties.is_empty())
         return object;
 
@@ -1760,6 +1809,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
             original_callee = local;
         } else if (identifier.is_global()) {
             original_callee = m_callee->generate_bytecode(generator).value();
+            builtin = Bytecode::get_builtin(identifier);
         } else {
             original_callee = generator.allocate_register();
             original_this_value = generator.allocate_register();
@@ -29,4 +29,37 @@ void BasicBlock::grow(size_t additional_size)
     m_buffer.resize(m_buffer.size() + additional_size);
 }
 
+size_t BasicBlock::remove_instructions_if(Badge<Generator>, Function<bool(Instruction const&)> should_remove)
+{
+    Vector<u8> new_buffer;
+    new_buffer.ensure_capacity(m_buffer.size());
+    HashMap<size_t, SourceRecord> new_source_map;
+    size_t new_last_instruction_start_offset = 0;
+    size_t removed_count = 0;
+
+    InstructionStreamIterator it(instruction_stream());
+    while (!it.at_end()) {
+        auto const& instruction = *it;
+        auto offset = it.offset();
+        auto length = instruction.length();
+        if (should_remove(instruction)) {
+            ++removed_count;
+        } else {
+            if (auto source_record = m_source_map.get(offset); source_record.has_value())
+                new_source_map.set(new_buffer.size(), source_record.value());
+            new_last_instruction_start_offset = new_buffer.size();
+            new_buffer.append(m_buffer.data() + offset, length);
+        }
+        ++it;
+    }
+
+    if (removed_count == 0)
+        return 0;
+
+    m_buffer = move(new_buffer);
+    m_source_map = move(new_source_map);
+    m_last_instruction_start_offset = new_last_instruction_start_offset;
+    return removed_count;
+}
+
 }
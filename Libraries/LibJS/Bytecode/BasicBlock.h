@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <LibGC/Root.h>
 #include <LibJS/Bytecode/Executable.h>
@@ -30,6 +31,7 @@ public:
     ~BasicBlock();
 
     u32 index() const { return m_index; }
+    void set_index(Badge<Generator>, u32 index) { m_index = index; }
 
     ReadonlyBytes instruction_stream() const LIFETIME_BOUND { return m_buffer.span(); }
     u8* data() { return m_buffer.data(); }
@@ -44,6 +46,10 @@ public:
 
     void grow(size_t additional_size);
 
+    // Removes every instruction for which the callback returns true, keeping the source map in sync.
+    // Returns the number of removed instructions.
+    size_t remove_instructions_if(Badge<Generator>, Function<bool(Instruction const&)>);
+
     void terminate(Badge<Generator>) { m_terminated = true; }
     bool is_terminated() const { return m_terminated; }
 
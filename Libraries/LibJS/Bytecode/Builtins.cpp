@@ -23,4 +23,18 @@ Optional<Builtin> get_builtin(MemberExpression const& expression)
     return {};
 }
 
+// NOTE: Builtins with a `globalThis` base can also be called as plain global identifiers, e.g. `parseInt(x, 10)`.
+Optional<Builtin> get_builtin(Identifier const& identifier)
+{
+    if (!identifier.is_global())
+        return {};
+    auto name = identifier.string();
+#define CHECK_GLOBAL_BUILTIN(builtin_name, snake_case_name, base, property, ...) \
+    if (#base##sv == "globalThis"sv && name == #property##sv)                    \
+        return Builtin::builtin_name;
+    JS_ENUMERATE_BUILTINS(CHECK_GLOBAL_BUILTIN)
+#undef CHECK_GLOBAL_BUILTIN
+    return {};
+}
+
 }
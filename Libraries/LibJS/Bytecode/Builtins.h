@@ -26,11 +26,25 @@ namespace JS::Bytecode {
     O(MathSin, math_sin, Math, sin, 1)                                                            \
     O(MathCos, math_cos, Math, cos, 1)                                                            \
     O(MathTan, math_tan, Math, tan, 1)                                                            \
+    O(MathTrunc, math_trunc, Math, trunc, 1)                                                      \
+    O(MathSign, math_sign, Math, sign, 1)                                                         \
+    O(MathClz32, math_clz32, Math, clz32, 1)                                                      \
+    O(MathFround, math_fround, Math, fround, 1)                                                   \
+    O(MathAtan2, math_atan2, Math, atan2, 2)                                                      \
+    O(MathMax, math_max, Math, max, 2)                                                            \
+    O(MathMin, math_min, Math, min, 2)                                                            \
+    O(NumberIsFinite, number_is_finite, Number, isFinite, 1)                                      \
+    O(NumberIsInteger, number_is_integer, Number, isInteger, 1)                                   \
+    O(NumberIsNaN, number_is_nan, Number, isNaN, 1)                                               \
+    O(NumberIsSafeInteger, number_is_safe_integer, Number, isSafeInteger, 1)                      \
+    O(NumberParseInt, number_parse_int, Number, parseInt, 2)                                      \
+    O(GlobalParseInt, global_parse_int, globalThis, parseInt, 2)                                  \
     O(OrdinaryHasInstance, ordinary_has_instance, InternalBuiltin, ordinary_has_instance, 1)      \
     O(ArrayIteratorPrototypeNext, array_iterator_prototype_next, ArrayIteratorPrototype, next, 0) \
     O(MapIteratorPrototypeNext, map_iterator_prototype_next, MapIteratorPrototype, next, 0)       \
     O(SetIteratorPrototypeNext, set_iterator_prototype_next, SetIteratorPrototype, next, 0)       \
-    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0)
+    O(StringIteratorPrototypeNext, string_iterator_prototype_next, StringIteratorPrototype, next, 0) \
+    O(GeneratorPrototypeNext, generator_prototype_next, GeneratorPrototype, next, 1)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
@@ -68,6 +82,7 @@ inline size_t builtin_argument_count(Builtin value)
 }
 
 Optional<Builtin> get_builtin(MemberExpression const& expression);
+Optional<Builtin> get_builtin(Identifier const& identifier);
 
 }
 
@@ -55,6 +55,14 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Describes an object literal whose properties are all plain data properties with distinct, constant names.
+// The shape its first evaluation ended up with is remembered, so later evaluations can create the object with
+// all properties in place instead of going through one shape transition per property.
+struct ObjectLiteralTemplate {
+    Vector<IdentifierTableIndex> property_names;
+    GC::Weak<Shape> shape;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -83,6 +91,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<ObjectLiteralTemplate> object_literal_templates;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -217,8 +218,13 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(S
     return {};
 }
 
-CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled, Vector<LocalVariable> local_variable_names)
+CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled, Vector<LocalVariable> local_variable_names, RunOptimizationPasses optimization_passes)
 {
+    // NOTE: To show what the optimization passes did, we compile the same node a second time without them.
+    GC::Ptr<Executable> unoptimized_executable;
+    if (g_dump_bytecode_optimizations && optimization_passes == RunOptimizationPasses::Yes)
+        unoptimized_executable = TRY(compile(vm, node, enclosing_function_kind, shared_function_instance_data, must_propagate_completion, builtin_abstract_operations_enabled, local_variable_names, RunOptimizationPasses::No));
+
     Generator generator(vm, shared_function_instance_data, must_propagate_completion, builtin_abstract_operations_enabled);
 
     if (is<Program>(node))
@@ -269,6 +275,9 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         }
     }
 
+    if (optimization_passes == RunOptimizationPasses::Yes)
+        generator.run_optimization_passes();
+
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
         size_needed += block->size();
@@ -480,6 +489,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         return a.start_offset < b.start_offset;
     });
 
+    executable->object_literal_templates = move(generator.m_object_literal_templates);
     executable->exception_handlers = move(linked_exception_handlers);
     executable->basic_block_start_offsets = move(basic_block_start_offsets);
     executable->source_map = move(source_map);
@@ -492,6 +502,16 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
 
     generator.m_finished = true;
 
+    if (unoptimized_executable) {
+        auto name = shared_function_instance_data ? shared_function_instance_data->m_name : Utf16FlyString {};
+        unoptimized_executable->name = name;
+        executable->name = name;
+        warnln("\033[37;1mBefore optimization passes\033[0m: {} bytes, {} registers", unoptimized_executable->bytecode.size(), unoptimized_executable->number_of_registers);
+        unoptimized_executable->dump();
+        warnln("\033[37;1mAfter optimization passes\033[0m: {} bytes, {} registers", executable->bytecode.size(), executable->number_of_registers);
+        executable->dump();
+    }
+
     return executable;
 }
 
@@ -344,6 +344,12 @@ public:
     [[nodiscard]] size_t next_global_variable_cache() { return m_next_global_variable_cache++; }
     [[nodiscard]] size_t next_property_lookup_cache() { return m_next_property_lookup_cache++; }
 
+    [[nodiscard]] u32 add_object_literal_template(Vector<IdentifierTableIndex> property_names)
+    {
+        m_object_literal_templates.append({ .property_names = move(property_names), .shape = {} });
+        return m_object_literal_templates.size() - 1;
+    }
+
     enum class DeduplicateConstant {
         Yes,
         No,
@@ -370,7 +376,20 @@ public:
 private:
     VM& m_vm;
 
-    static CodeGenerationErrorOr<GC::Ref<Executable>> compile(VM&, ASTNode const&, FunctionKind, GC::Ptr<SharedFunctionInstanceData const>, MustPropagateCompletion, BuiltinAbstractOperationsEnabled, Vector<LocalVariable> local_variable_names);
+    enum class RunOptimizationPasses {
+        No,
+        Yes,
+    };
+
+    static CodeGenerationErrorOr<GC::Ref<Executable>> compile(VM&, ASTNode const&, FunctionKind, GC::Ptr<SharedFunctionInstanceData const>, MustPropagateCompletion, BuiltinAbstractOperationsEnabled, Vector<LocalVariable> local_variable_names, RunOptimizationPasses = RunOptimizationPasses::Yes);
+
+    // Optimization passes over m_root_basic_blocks, run once code generation has finished. (See Optimizer.cpp)
+    void run_optimization_passes();
+    void thread_jumps();
+    void propagate_constants();
+    void remove_unreachable_blocks();
+    void remove_dead_moves();
+    void compact_registers();
 
     enum class JumpType {
         Continue,
@@ -420,6 +439,7 @@ private:
     u32 m_next_block { 1 };
     u32 m_next_property_lookup_cache { 0 };
     u32 m_next_global_variable_cache { 0 };
+    Vector<ObjectLiteralTemplate> m_object_literal_templates;
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
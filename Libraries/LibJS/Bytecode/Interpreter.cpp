@@ -30,13 +30,13 @@
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/Environment.h>
 #include <LibJS/Runtime/FunctionEnvironment.h>
-#include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/MathObject.h>
 #include <LibJS/Runtime/ModuleEnvironment.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/NumberConstructor.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
@@ -49,6 +49,7 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_dump_bytecode_optimizations = false;
 
 ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value src1, Value src2)
 {
@@ -105,12 +106,16 @@ ALWAYS_INLINE void Interpreter::set(Operand op, Value value)
     m_running_execution_context->registers_and_constants_and_locals_and_arguments()[op.index()] = value;
 }
 
-ALWAYS_INLINE Value Interpreter::do_yield(Value value, Optional<Label> continuation)
+ALWAYS_INLINE void Interpreter::do_yield(Value value, Optional<Label> continuation, bool is_await)
 {
-    // FIXME: If we get a pointer, which is not accurately representable as a double
-    //        will cause this to explode
-    auto continuation_value = continuation.has_value() ? Value(continuation->address()) : js_null();
-    return vm().heap().allocate<GeneratorResult>(value, continuation_value, false).ptr();
+    // NOTE: The resumption point lives in the generator's own execution context, so suspending doesn't allocate.
+    auto& context = *m_running_execution_context;
+    if (continuation.has_value())
+        context.yield_continuation = static_cast<u32>(continuation->address());
+    else
+        context.yield_continuation = {};
+    context.yield_is_await = is_await;
+    do_return(value);
 }
 
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
@@ -570,6 +575,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(NewClass);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewFunction);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewObject);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewObjectFromTemplate);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewObjectWithNoPrototype);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewPrimitiveArray);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewRegExp);
@@ -673,8 +679,13 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
         reg(Register::this_value()) = context.this_value.value_or(js_special_empty_value());
 
     auto* registers_and_constants_and_locals_and_arguments = context.registers_and_constants_and_locals_and_arguments();
-    for (size_t i = 0; i < executable.constants.size(); ++i) {
-        registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
+
+    // OPTIMIZATION: Resuming a generator re-enters the same context it was suspended in, and nothing ever writes to
+    //               the constant slots, so they only need to be filled on the first entry.
+    if (!entry_point.has_value()) {
+        for (size_t i = 0; i < executable.constants.size(); ++i) {
+            registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
+        }
     }
 
     run_bytecode(entry_point.value_or(0));
@@ -2107,7 +2118,36 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
     auto& realm = *vm.current_realm();
-    interpreter.set(dst(), Object::create(realm, realm.intrinsics().object_prototype()));
+    auto object = Object::create(realm, realm.intrinsics().object_prototype());
+    if (m_expected_property_count > 0)
+        object->reserve_named_property_storage(m_expected_property_count);
+    interpreter.set(dst(), object);
+}
+
+void NewObjectFromTemplate::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto& realm = *vm.current_realm();
+    auto& executable = interpreter.current_executable();
+    auto& object_literal_template = executable.object_literal_templates[m_template_index];
+    auto prototype = realm.intrinsics().object_prototype();
+
+    // NOTE: The template's shape was created by adding the properties in order to an empty object with this prototype,
+    //       so the property at index i lives at storage offset i.
+    if (auto shape = object_literal_template.shape; shape && shape->prototype() == prototype.ptr()) {
+        auto object = Object::create_with_premade_shape(*shape);
+        for (size_t i = 0; i < m_value_count; ++i)
+            object->put_direct(i, interpreter.get(m_values[i]));
+        interpreter.set(dst(), object);
+        return;
+    }
+
+    auto object = Object::create(realm, prototype);
+    for (size_t i = 0; i < m_value_count; ++i)
+        object->define_direct_property(executable.get_identifier(object_literal_template.property_names[i]), interpreter.get(m_values[i]), default_attributes);
+    if (!object->shape().is_dictionary())
+        object_literal_template.shape = object->shape();
+    interpreter.set(dst(), object);
 }
 
 void NewObjectWithNoPrototype::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -2718,10 +2758,36 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
         return TRY(MathObject::cos_impl(interpreter.vm(), interpreter.get(arguments[0])));
     case Builtin::MathTan:
         return TRY(MathObject::tan_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathTrunc:
+        return TRY(MathObject::trunc_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathSign:
+        return TRY(MathObject::sign_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathClz32:
+        return TRY(MathObject::clz32_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathFround:
+        return TRY(MathObject::fround_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathAtan2:
+        return TRY(MathObject::atan2_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::MathMax:
+        return TRY(MathObject::max_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::MathMin:
+        return TRY(MathObject::min_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::NumberIsFinite:
+        return Value(interpreter.get(arguments[0]).is_finite_number());
+    case Builtin::NumberIsInteger:
+        return Value(interpreter.get(arguments[0]).is_integral_number());
+    case Builtin::NumberIsNaN:
+        return Value(interpreter.get(arguments[0]).is_nan());
+    case Builtin::NumberIsSafeInteger:
+        return Value(NumberConstructor::is_safe_integer_impl(interpreter.get(arguments[0])));
+    case Builtin::NumberParseInt:
+    case Builtin::GlobalParseInt:
+        return TRY(GlobalObject::parse_int_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
     case Builtin::ArrayIteratorPrototypeNext:
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
+    case Builtin::GeneratorPrototypeNext:
         VERIFY_NOT_REACHED();
     case Builtin::OrdinaryHasInstance:
         VERIFY_NOT_REACHED();
@@ -3084,24 +3150,19 @@ void LeaveUnwindContext::execute_impl(Bytecode::Interpreter& interpreter) const
 void Yield::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto yielded_value = interpreter.get(m_value).is_special_empty_value() ? js_undefined() : interpreter.get(m_value);
-    interpreter.do_return(
-        interpreter.do_yield(yielded_value, m_continuation_label));
+    interpreter.do_yield(yielded_value, m_continuation_label, false);
 }
 
 void PrepareYield::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto value = interpreter.get(m_value).is_special_empty_value() ? js_undefined() : interpreter.get(m_value);
-    interpreter.set(m_dest, interpreter.do_yield(value, {}));
+    interpreter.set(m_dest, value);
 }
 
 void Await::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto yielded_value = interpreter.get(m_argument).is_special_empty_value() ? js_undefined() : interpreter.get(m_argument);
-    // FIXME: If we get a pointer, which is not accurately representable as a double
-    //        will cause this to explode
-    auto continuation_value = Value(m_continuation_label.address());
-    auto result = interpreter.vm().heap().allocate<GeneratorResult>(yielded_value, continuation_value, true);
-    interpreter.do_return(result);
+    interpreter.do_yield(yielded_value, m_continuation_label, true);
 }
 
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -57,7 +57,7 @@ public:
     [[nodiscard]] Value get(Operand) const;
     void set(Operand, Value);
 
-    Value do_yield(Value value, Optional<Label> continuation);
+    void do_yield(Value value, Optional<Label> continuation, bool is_await);
     void do_return(Value value)
     {
         if (value.is_special_empty_value())
@@ -101,6 +101,7 @@ private:
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_dump_bytecode_optimizations;
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, GC::Ref<SharedFunctionInstanceData const>, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled);
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/Generator.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Register.h>
+#include <LibJS/Runtime/ValueInlines.h>
+
+namespace JS::Bytecode {
+
+template<typename Callback>
+static void for_each_instruction(BasicBlock& block, Callback callback)
+{
+    InstructionStreamIterator it(block.instruction_stream());
+    while (!it.at_end()) {
+        auto offset = it.offset();
+        callback(const_cast<Instruction&>(*it), offset);
+        ++it;
+    }
+}
+
+void Generator::run_optimization_passes()
+{
+    propagate_constants();
+    thread_jumps();
+    remove_unreachable_blocks();
+    remove_dead_moves();
+    compact_registers();
+}
+
+// Retargets every label that points at a block consisting of nothing but a `Jump` to wherever that jump leads.
+void Generator::thread_jumps()
+{
+    auto trampoline_target = [&](size_t block_index) -> Optional<size_t> {
+        auto& block = *m_root_basic_blocks[block_index];
+        if (!block.is_terminated() || block.size() == 0)
+            return {};
+        auto const& instruction = *InstructionStreamIterator { block.instruction_stream() };
+        if (instruction.type() != Instruction::Type::Jump)
+            return {};
+        return static_cast<Op::Jump const&>(instruction).target().basic_block_index();
+    };
+
+    Vector<u32> final_targets;
+    final_targets.ensure_capacity(m_root_basic_blocks.size());
+
+    for (size_t block_index = 0; block_index < m_root_basic_blocks.size(); ++block_index) {
+        auto target = block_index;
+        // NOTE: The step limit keeps us from spinning forever on a cycle of trampolines, e.g. `for (;;) {}`.
+        for (size_t step = 0; step < m_root_basic_blocks.size(); ++step) {
+            auto next_target = trampoline_target(target);
+            if (!next_target.has_value() || next_target.value() == target)
+                break;
+            target = next_target.value();
+        }
+        final_targets.unchecked_append(target);
+    }
+
+    for (auto& block : m_root_basic_blocks) {
+        for_each_instruction(*block, [&](Instruction& instruction, size_t) {
+            instruction.visit_labels([&](Label& label) {
+                label = Label { final_targets[label.basic_block_index()] };
+            });
+        });
+    }
+}
+
+// Forwards constants stored into registers by `Mov` to later `Mov`s and branch conditions in the same block,
+// then turns branches on a constant condition into unconditional jumps.
+void Generator::propagate_constants()
+{
+    for (auto& block : m_root_basic_blocks) {
+        HashMap<u32, Operand> register_constants;
+        Optional<size_t> terminator_offset;
+
+        auto constant_for = [&](Operand operand) -> Optional<Value> {
+            if (operand.is_register()) {
+                auto constant = register_constants.get(operand.index());
+                if (!constant.has_value())
+                    return {};
+                operand = constant.value();
+            }
+            if (!operand.is_constant())
+                return {};
+            auto value = m_constants[operand.index()];
+            if (value.is_special_empty_value())
+                return {};
+            return value;
+        };
+
+        Optional<Label> folded_target;
+
+        for_each_instruction(*block, [&](Instruction& instruction, size_t offset) {
+            switch (instruction.type()) {
+            case Instruction::Type::Mov: {
+                auto const& mov = static_cast<Op::Mov const&>(instruction);
+                auto dst = mov.dst();
+                auto src = mov.src();
+                if (src.is_register()) {
+                    if (auto constant = register_constants.get(src.index()); constant.has_value()) {
+                        src = constant.value();
+                        auto strict = instruction.strict();
+                        new (&instruction) Op::Mov(dst, src);
+                        instruction.set_strict(strict);
+                    }
+                }
+                if (dst.is_register()) {
+                    register_constants.remove(dst.index());
+                    if (src.is_constant() && dst.index() >= Register::reserved_register_count)
+                        register_constants.set(dst.index(), src);
+                }
+                return;
+            }
+            case Instruction::Type::JumpIf: {
+                auto const& jump = static_cast<Op::JumpIf const&>(instruction);
+                if (auto value = constant_for(jump.condition()); value.has_value())
+                    folded_target = value->to_boolean() ? jump.true_target() : jump.false_target();
+                terminator_offset = offset;
+                return;
+            }
+            case Instruction::Type::JumpNullish: {
+                auto const& jump = static_cast<Op::JumpNullish const&>(instruction);
+                if (auto value = constant_for(jump.condition()); value.has_value())
+                    folded_target = value->is_nullish() ? jump.true_target() : jump.false_target();
+                terminator_offset = offset;
+                return;
+            }
+            case Instruction::Type::JumpUndefined: {
+                auto const& jump = static_cast<Op::JumpUndefined const&>(instruction);
+                if (auto value = constant_for(jump.condition()); value.has_value())
+                    folded_target = value->is_undefined() ? jump.true_target() : jump.false_target();
+                terminator_offset = offset;
+                return;
+            }
+            default:
+                // NOTE: We don't know which operands an arbitrary instruction writes to, so forget everything it touches.
+                instruction.visit_operands([&](Operand& operand) {
+                    if (operand.is_register())
+                        register_constants.remove(operand.index());
+                });
+                return;
+            }
+        });
+
+        if (!folded_target.has_value())
+            continue;
+
+        auto strict = reinterpret_cast<Instruction const*>(block->data() + terminator_offset.value())->strict();
+        block->set_last_instruction_start_offset(terminator_offset.value());
+        block->rewind();
+        block->grow(sizeof(Op::Jump));
+        auto* jump = new (block->data() + terminator_offset.value()) Op::Jump(folded_target.value());
+        jump->set_strict(strict);
+        block->terminate({});
+    }
+}
+
+// Drops blocks that can't be reached from the entry block, either by a label or as an exception handler or finalizer.
+void Generator::remove_unreachable_blocks()
+{
+    Vector<bool> reachable;
+    reachable.resize(m_root_basic_blocks.size());
+
+    Vector<size_t> worklist;
+    auto mark_reachable = [&](size_t block_index) {
+        if (reachable[block_index])
+            return;
+        reachable[block_index] = true;
+        worklist.append(block_index);
+    };
+
+    mark_reachable(0);
+    while (!worklist.is_empty()) {
+        auto& block = *m_root_basic_blocks[worklist.take_last()];
+        if (block.handler())
+            mark_reachable(block.handler()->index());
+        if (block.finalizer())
+            mark_reachable(block.finalizer()->index());
+        for_each_instruction(block, [&](Instruction& instruction, size_t) {
+            instruction.visit_labels([&](Label& label) {
+                mark_reachable(label.basic_block_index());
+            });
+        });
+    }
+
+    if (!reachable.contains_slow(false))
+        return;
+
+    Vector<u32> new_indices;
+    new_indices.resize(m_root_basic_blocks.size());
+    u32 next_index = 0;
+    for (size_t block_index = 0; block_index < m_root_basic_blocks.size(); ++block_index) {
+        if (reachable[block_index])
+            new_indices[block_index] = next_index++;
+    }
+
+    m_root_basic_blocks.remove_all_matching([&](auto const& block) {
+        return !reachable[block->index()];
+    });
+    m_current_basic_block = nullptr;
+
+    for (auto& block : m_root_basic_blocks) {
+        block->set_index({}, new_indices[block->index()]);
+        for_each_instruction(*block, [&](Instruction& instruction, size_t) {
+            instruction.visit_labels([&](Label& label) {
+                label = Label { new_indices[label.basic_block_index()] };
+            });
+        });
+    }
+}
+
+// Removes `Mov`s that copy a register onto itself, and `Mov`s into temporary registers that are never read.
+void Generator::remove_dead_moves()
+{
+    Vector<u32> read_counts;
+    for (;;) {
+        read_counts.clear_with_capacity();
+        read_counts.resize(m_next_register);
+
+        for (auto& block : m_root_basic_blocks) {
+            for_each_instruction(*block, [&](Instruction& instruction, size_t) {
+                if (instruction.type() == Instruction::Type::Mov) {
+                    auto const& src = static_cast<Op::Mov const&>(instruction).src();
+                    if (src.is_register())
+                        ++read_counts[src.index()];
+                    return;
+                }
+                // NOTE: Any other mention of a register counts as a read, since we can't tell inputs from outputs here.
+                instruction.visit_operands([&](Operand& operand) {
+                    if (operand.is_register())
+                        ++read_counts[operand.index()];
+                });
+            });
+        }
+
+        size_t removed_count = 0;
+        for (auto& block : m_root_basic_blocks) {
+            removed_count += block->remove_instructions_if({}, [&](Instruction const& instruction) {
+                if (instruction.type() != Instruction::Type::Mov)
+                    return false;
+                auto const& mov = static_cast<Op::Mov const&>(instruction);
+                if (mov.dst() == mov.src())
+                    return true;
+                return mov.dst().is_register()
+                    && mov.dst().index() >= Register::reserved_register_count
+                    && read_counts[mov.dst().index()] == 0;
+            });
+        }
+
+        // Removing a move may have left its source register unread, so go again until nothing changes.
+        if (removed_count == 0)
+            break;
+    }
+}
+
+// Renumbers the temporary registers that are still in use after the other passes so they're contiguous.
+void Generator::compact_registers()
+{
+    Vector<bool> used;
+    used.resize(m_next_register);
+
+    for (auto& block : m_root_basic_blocks) {
+        for_each_instruction(*block, [&](Instruction& instruction, size_t) {
+            instruction.visit_operands([&](Operand& operand) {
+                if (operand.is_register())
+                    used[operand.index()] = true;
+            });
+        });
+    }
+
+    Vector<u32> new_indices;
+    new_indices.resize(m_next_register);
+    u32 next_register = Register::reserved_register_count;
+    for (u32 index = 0; index < m_next_register; ++index) {
+        if (index < Register::reserved_register_count)
+            new_indices[index] = index;
+        else if (used[index])
+            new_indices[index] = next_register++;
+    }
+
+    if (next_register == m_next_register)
+        return;
+
+    for (auto& block : m_root_basic_blocks) {
+        for_each_instruction(*block, [&](Instruction& instruction, size_t) {
+            instruction.visit_operands([&](Operand& operand) {
+                if (operand.is_register())
+                    operand = Operand { Register { new_indices[operand.index()] } };
+            });
+        });
+    }
+
+    m_next_register = next_register;
+    m_free_registers.clear();
+}
+
+}
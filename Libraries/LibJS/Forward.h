@@ -169,6 +169,7 @@ class Cell;
 class ClassExpression;
 struct ClassFieldDefinition;
 class Completion;
+class CompletionCell;
 class Console;
 class CyclicModule;
 class DeclarativeEnvironment;
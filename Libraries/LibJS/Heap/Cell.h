@@ -18,8 +18,6 @@ class JS_API Cell : public GC::Cell {
 public:
     virtual void initialize(Realm&);
 
-    virtual bool is_generator_result() const { return false; }
-
     ALWAYS_INLINE VM& vm() const { return *reinterpret_cast<VM*>(private_data()); }
 };
 
@@ -10,7 +10,6 @@
 #include <LibJS/Runtime/AsyncGeneratorRequest.h>
 #include <LibJS/Runtime/CompletionCell.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
-#include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeJavaScriptBackedFunction.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
@@ -19,7 +18,7 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(AsyncGenerator);
 
-GC::Ref<AsyncGenerator> AsyncGenerator::create(Realm& realm, Value initial_value, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>> generating_function, NonnullOwnPtr<ExecutionContext> execution_context)
+GC::Ref<AsyncGenerator> AsyncGenerator::create(Realm& realm, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>> generating_function, NonnullOwnPtr<ExecutionContext> execution_context)
 {
     auto& vm = realm.vm();
     // This is "g1.prototype" in figure-2 (https://tc39.es/ecma262/img/figure-2.png)
@@ -39,15 +38,17 @@ GC::Ref<AsyncGenerator> AsyncGenerator::create(Realm& realm, Value initial_value
             return function->bytecode_executable();
         });
 
-    return realm.create<AsyncGenerator>(realm, generating_function_prototype_object, move(execution_context), generating_executable, initial_value);
+    return realm.create<AsyncGenerator>(realm, generating_function_prototype_object, move(execution_context), generating_executable);
 }
 
-AsyncGenerator::AsyncGenerator(Realm& realm, Object* prototype, NonnullOwnPtr<ExecutionContext> context, GC::Ref<Bytecode::Executable> bytecode_executable, Value initial_value)
+AsyncGenerator::AsyncGenerator(Realm& realm, Object* prototype, NonnullOwnPtr<ExecutionContext> context, GC::Ref<Bytecode::Executable> bytecode_executable)
     : Object(realm, prototype)
     , m_async_generator_context(move(context))
     , m_generating_executable(bytecode_executable)
-    , m_previous_value(initial_value)
 {
+    // NOTE: The context was copied right after the generator body suspended at its initial yield.
+    if (auto continuation = exchange(m_async_generator_context->yield_continuation, {}); continuation.has_value())
+        m_continuation = *continuation;
 }
 
 AsyncGenerator::~AsyncGenerator() = default;
@@ -61,6 +62,7 @@ void AsyncGenerator::visit_edges(Cell::Visitor& visitor)
     }
     visitor.visit(m_generating_executable);
     visitor.visit(m_previous_value);
+    visitor.visit(m_completion_cell);
     visitor.visit(m_current_promise);
     m_async_generator_context->visit_edges(visitor);
 }
@@ -169,42 +171,34 @@ void AsyncGenerator::execute(VM& vm, Completion completion)
     while (true) {
         // Loosely based on step 4 of https://tc39.es/ecma262/#sec-asyncgeneratorstart
         auto generated_value = [](Value value) -> Value {
-            if (value.is_cell() && value.as_cell().is_generator_result())
-                return static_cast<GeneratorResult const&>(value.as_cell()).result();
             return value.is_special_empty_value() ? js_undefined() : value;
         };
 
-        auto generated_continuation = [&](Value value) -> Optional<size_t> {
-            if (value.is_cell() && value.as_cell().is_generator_result()) {
-                auto number_value = static_cast<GeneratorResult const&>(value.as_cell()).continuation();
-                if (number_value.is_null())
-                    return {};
-                return static_cast<size_t>(number_value.as_double());
-            }
-            return {};
-        };
-
-        auto generated_is_await = [](Value value) -> bool {
-            if (value.is_cell() && value.as_cell().is_generator_result())
-                return static_cast<GeneratorResult const&>(value.as_cell()).is_await();
-            return false;
-        };
-
-        auto completion_cell = heap().allocate<CompletionCell>(completion);
+        // OPTIMIZATION: The resumption completion is only read right after re-entering the generator, so a single
+        //               cell can be reused for every step instead of allocating a new one each time.
+        if (!m_completion_cell)
+            m_completion_cell = heap().allocate<CompletionCell>(completion);
+        else
+            m_completion_cell->set_completion(completion);
 
         auto& bytecode_interpreter = vm.bytecode_interpreter();
 
-        auto const continuation_address = generated_continuation(m_previous_value);
-
         // We should never enter `execute` again after the generator is complete.
-        VERIFY(continuation_address.has_value());
+        VERIFY(m_continuation.has_value());
+
+        auto result_value = bytecode_interpreter.run_executable(*m_async_generator_context, m_generating_executable, m_continuation, m_completion_cell);
 
-        auto result_value = bytecode_interpreter.run_executable(vm.running_execution_context(), m_generating_executable, continuation_address, completion_cell);
+        // NOTE: Only a Yield or Await leaves a continuation behind; anything else means the generator body has finished.
+        auto continuation = exchange(m_async_generator_context->yield_continuation, {});
+        bool is_await = exchange(m_async_generator_context->yield_is_await, false);
+        if (continuation.has_value())
+            m_continuation = *continuation;
+        else
+            m_continuation = {};
 
         if (!result_value.is_throw_completion()) {
             m_previous_value = result_value.release_value();
             auto value = generated_value(m_previous_value);
-            bool is_await = generated_is_await(m_previous_value);
 
             if (is_await) {
                 auto await_result = this->await(value);
@@ -216,7 +210,7 @@ void AsyncGenerator::execute(VM& vm, Completion completion)
             }
         }
 
-        bool done = result_value.is_throw_completion() || !generated_continuation(m_previous_value).has_value();
+        bool done = result_value.is_throw_completion() || !m_continuation.has_value();
         if (!done) {
             // 27.6.3.8 AsyncGeneratorYield ( value ), https://tc39.es/ecma262/#sec-asyncgeneratoryield
             // 1. Let genContext be the running execution context.
@@ -289,6 +289,12 @@ FLATTEN ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_co
     if (kind == ConstructorKind::Base) {
         // a. Let thisArgument be ? OrdinaryCreateFromConstructor(newTarget, "%Object.prototype%").
         this_argument = TRY(ordinary_create_from_constructor<Object>(vm, *realm(), new_target, &Intrinsics::object_prototype, ConstructWithPrototypeTag::Tag));
+
+        // OPTIMIZATION: This is the allocation site of every object this constructor creates, and constructors tend to add
+        //               the same properties to all of them. So we size the property storage to exactly what the previous
+        //               object created here ended up with, allocating it once instead of growing it repeatedly.
+        if (auto expected_property_count = shared_data().m_expected_property_count; expected_property_count > 0)
+            this_argument->reserve_named_property_storage(expected_property_count);
     }
 
     // 4. Let calleeContext be PrepareForOrdinaryCall(F, newTarget).
@@ -339,8 +345,11 @@ FLATTEN ThrowCompletionOr<GC::Ref<Object>> ECMAScriptFunctionObject::internal_co
         return GC::Ref<Object> { const_cast<Object&>(result.value().as_object()) };
 
     // 13. If kind is base, return thisArgument.
-    if (kind == ConstructorKind::Base)
+    if (kind == ConstructorKind::Base) {
+        static constexpr u32 max_expected_property_count = 64;
+        shared_data().m_expected_property_count = min(this_argument->shape().property_count(), max_expected_property_count);
         return *this_argument;
+    }
 
     // 14. If result.[[Value]] is not undefined, throw a TypeError exception.
     if (!result.value().is_undefined())
@@ -607,9 +616,9 @@ ThrowCompletionOr<Value> ECMAScriptFunctionObject::ordinary_call_evaluate_body(V
         return result;
 
     if (kind() == FunctionKind::AsyncGenerator)
-        return AsyncGenerator::create(*context.realm, result, GC::Ref { *this }, context.copy());
+        return AsyncGenerator::create(*context.realm, GC::Ref { *this }, context.copy());
 
-    auto generator_object = GeneratorObject::create(*context.realm, result, GC::Ref { *this }, context.copy());
+    auto generator_object = GeneratorObject::create(*context.realm, GC::Ref { *this }, context.copy());
 
     // NOTE: Async functions are entirely transformed to generator functions, and wrapped in a custom driver that returns a promise
     //       See AwaitExpression::generate_bytecode() for the transformation.
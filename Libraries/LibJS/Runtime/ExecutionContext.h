@@ -95,6 +95,10 @@ public:
 
     u32 program_counter { 0 };
 
+    // Set by Yield and Await when they suspend a generator or async function, and taken by whoever resumes it.
+    Optional<u32> yield_continuation;
+    bool yield_is_await { false };
+
     // https://html.spec.whatwg.org/multipage/webappapis.html#skip-when-determining-incumbent-counter
     // FIXME: Move this out of LibJS (e.g. by using the CustomData concept), as it's used exclusively by LibWeb.
     u32 skip_when_determining_incumbent_counter { 0 };
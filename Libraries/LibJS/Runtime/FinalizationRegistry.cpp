@@ -55,9 +55,13 @@ void FinalizationRegistry::remove_dead_cells(Badge<GC::Heap>)
             continue;
         record.target = nullptr;
         any_cells_were_removed = true;
-        break;
     }
-    if (any_cells_were_removed) {
+
+    // NOTE: A single cleanup job handles every record with an empty target, so there is no need to enqueue
+    //       another one while the previous job hasn't run yet.
+    if (any_cells_were_removed && !m_cleanup_job_pending) {
+        m_cleanup_job_pending = true;
+
         // NOTE: We make a GC::Root here to ensure that the FinalizationRegistry stays alive
         //       even if a subsequent GC is triggered before the callback has a chance to run.
         heap().enqueue_post_gc_task([that = GC::make_root(this)]() {
@@ -77,6 +81,9 @@ ThrowCompletionOr<void> FinalizationRegistry::cleanup(GC::Ptr<JobCallback> callb
     // 2. Let callback be finalizationRegistry.[[CleanupCallback]].
     auto cleanup_callback = callback ? callback : m_cleanup_callback;
 
+    // NOTE: Any cells emptied by a GC during the callbacks below will need a new cleanup job.
+    m_cleanup_job_pending = false;
+
     // 3. While finalizationRegistry.[[Cells]] contains a Record cell such that cell.[[WeakRefTarget]] is empty, an implementation may perform the following steps:
     for (auto it = m_records.begin(); it != m_records.end(); ++it) {
         // a. Choose any such cell.
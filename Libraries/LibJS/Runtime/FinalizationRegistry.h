@@ -53,6 +53,7 @@ private:
         GC::Ptr<Cell> unregister_token;
     };
     SinglyLinkedList<FinalizationRecord> m_records;
+    bool m_cleanup_job_pending { false };
 };
 
 }
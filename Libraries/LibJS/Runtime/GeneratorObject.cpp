@@ -10,16 +10,16 @@
 #include <LibJS/Runtime/CompletionCell.h>
 #include <LibJS/Runtime/GeneratorObject.h>
 #include <LibJS/Runtime/GeneratorPrototype.h>
-#include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/NativeJavaScriptBackedFunction.h>
 
 namespace JS {
 
 GC_DEFINE_ALLOCATOR(GeneratorObject);
 
-GC::Ref<GeneratorObject> GeneratorObject::create(Realm& realm, Value initial_value, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>> generating_function, NonnullOwnPtr<ExecutionContext> execution_context)
+GC::Ref<GeneratorObject> GeneratorObject::create(Realm& realm, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>> generating_function, NonnullOwnPtr<ExecutionContext> execution_context)
 {
     auto& vm = realm.vm();
     // This is "g1.prototype" in figure-2 (https://tc39.es/ecma262/img/figure-2.png)
@@ -55,9 +55,13 @@ GC::Ref<GeneratorObject> GeneratorObject::create(Realm& realm, Value initial_val
             return function->bytecode_executable();
         });
 
+    // NOTE: The context was copied right after the generator body suspended at its initial yield.
+    auto continuation = exchange(execution_context->yield_continuation, {});
+
     auto object = realm.create<GeneratorObject>(realm, generating_function_prototype_object, move(execution_context));
     object->m_generating_executable = generating_executable;
-    object->m_previous_value = initial_value;
+    if (continuation.has_value())
+        object->m_continuation = *continuation;
     return object;
 }
 
@@ -72,10 +76,32 @@ void GeneratorObject::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_generating_executable);
-    visitor.visit(m_previous_value);
+    visitor.visit(m_completion_cell);
     m_execution_context->visit_edges(visitor);
 }
 
+BuiltinIterator* GeneratorObject::as_builtin_iterator_if_next_is_not_redefined(Value next_method)
+{
+    if (next_method.is_object()) {
+        auto const& next_function = next_method.as_object();
+        if (next_function.is_native_function()) {
+            auto const& native_function = static_cast<NativeFunction const&>(next_function);
+            if (native_function.is_generator_prototype_next_builtin())
+                return this;
+        }
+    }
+    return nullptr;
+}
+
+// OPTIMIZATION: This is %GeneratorPrototype%.next() without the iterator result object, for use by IteratorStep.
+ThrowCompletionOr<void> GeneratorObject::next(VM& vm, bool& done, Value& value)
+{
+    auto iteration_result = TRY(resume(vm, js_undefined(), {}));
+    done = iteration_result.done;
+    value = iteration_result.value;
+    return {};
+}
+
 // 27.5.3.2 GeneratorValidate ( generator, generatorBrand ), https://tc39.es/ecma262/#sec-generatorvalidate
 ThrowCompletionOr<GeneratorObject::GeneratorState> GeneratorObject::validate(VM& vm, Optional<StringView> const& generator_brand)
 {
@@ -105,46 +131,41 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
 {
     // Loosely based on step 4 of https://tc39.es/ecma262/#sec-generatorstart mixed with https://tc39.es/ecma262/#sec-generatoryield at the end.
 
-    auto generated_value = [](Value value) -> Value {
-        if (value.is_cell() && value.as_cell().is_generator_result())
-            return static_cast<GeneratorResult const&>(value.as_cell()).result();
-        return value.is_special_empty_value() ? js_undefined() : value;
-    };
-
-    auto generated_continuation = [&](Value value) -> Optional<size_t> {
-        if (value.is_cell() && value.as_cell().is_generator_result()) {
-            auto number_value = static_cast<GeneratorResult const&>(value.as_cell()).continuation();
-            if (number_value.is_null())
-                return {};
-            return static_cast<u64>(number_value.as_double());
-        }
-        return {};
-    };
-
-    auto completion_cell = heap().allocate<CompletionCell>(completion);
+    // OPTIMIZATION: The resumption completion is only read right after re-entering the generator, so a single cell
+    //               can be reused for every step instead of allocating a new one each time.
+    if (!m_completion_cell)
+        m_completion_cell = heap().allocate<CompletionCell>(completion);
+    else
+        m_completion_cell->set_completion(completion);
 
     auto& bytecode_interpreter = vm.bytecode_interpreter();
 
-    auto const next_block = generated_continuation(m_previous_value);
-
     // We should never enter `execute` again after the generator is complete.
-    VERIFY(next_block.has_value());
+    VERIFY(m_continuation.has_value());
 
-    auto result_value = bytecode_interpreter.run_executable(vm.running_execution_context(), *m_generating_executable, next_block, completion_cell);
+    auto result_value = bytecode_interpreter.run_executable(*m_execution_context, *m_generating_executable, m_continuation, m_completion_cell);
 
     vm.pop_execution_context();
 
+    // NOTE: Only a Yield or Await leaves a continuation behind; anything else means the generator body has finished.
+    auto continuation = exchange(m_execution_context->yield_continuation, {});
+    m_execution_context->yield_is_await = false;
+    if (continuation.has_value())
+        m_continuation = *continuation;
+    else
+        m_continuation = {};
+
     if (result_value.is_throw_completion()) {
         // Uncaught exceptions disable the generator.
         m_generator_state = GeneratorState::Completed;
         return result_value.throw_completion();
     }
-    m_previous_value = result_value.release_value();
-    bool done = !generated_continuation(m_previous_value).has_value();
+    auto value = result_value.release_value();
+    bool done = !m_continuation.has_value();
 
     m_generator_state = done ? GeneratorState::Completed : GeneratorState::SuspendedYield;
 
-    return IterationResult(generated_value(m_previous_value), done);
+    return IterationResult(value.is_special_empty_value() ? js_undefined() : value, done);
 }
 
 // 27.5.3.3 GeneratorResume ( generator, value, generatorBrand ), https://tc39.es/ecma262/#sec-generatorresume
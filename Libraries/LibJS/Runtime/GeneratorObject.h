@@ -8,19 +8,25 @@
 
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
 
-class GeneratorObject : public Object {
+class GeneratorObject
+    : public Object
+    , public BuiltinIterator {
     JS_OBJECT(GeneratorObject, Object);
     GC_DECLARE_ALLOCATOR(GeneratorObject);
 
 public:
-    static GC::Ref<GeneratorObject> create(Realm&, Value, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>>, NonnullOwnPtr<ExecutionContext>);
+    static GC::Ref<GeneratorObject> create(Realm&, Variant<GC::Ref<ECMAScriptFunctionObject>, GC::Ref<NativeJavaScriptBackedFunction>>, NonnullOwnPtr<ExecutionContext>);
     virtual ~GeneratorObject() override = default;
     void visit_edges(Cell::Visitor&) override;
 
+    BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(Value next_method) override;
+    ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
+
     struct IterationResult {
         IterationResult() = delete;
         explicit IterationResult(Value value, bool done)
@@ -54,7 +60,8 @@ protected:
 private:
     NonnullOwnPtr<ExecutionContext> m_execution_context;
     GC::Ptr<Bytecode::Executable> m_generating_executable;
-    Value m_previous_value;
+    GC::Ptr<CompletionCell> m_completion_cell;
+    Optional<size_t> m_continuation;
     GeneratorState m_generator_state { GeneratorState::SuspendedStart };
     Optional<StringView> m_generator_brand;
 };
@@ -287,9 +287,11 @@ JS_DEFINE_NATIVE_FUNCTION(GlobalObject::parse_float)
 }
 
 // 19.2.5 parseInt ( string, radix ), https://tc39.es/ecma262/#sec-parseint-string-radix
-JS_DEFINE_NATIVE_FUNCTION(GlobalObject::parse_int)
+ThrowCompletionOr<Value> GlobalObject::parse_int_impl(VM& vm, Value string, Value radix_value)
 {
-    auto string = vm.argument(0);
+    // OPTIMIZATION: The decimal representation of an Int32 value parses back to the same value.
+    if (string.is_int32() && (radix_value.is_undefined() || (radix_value.is_int32() && radix_value.as_i32() == 10)))
+        return string;
 
     // 1. Let inputString be ? ToString(string).
     auto input_string = TRY(string.to_string(vm));
@@ -317,7 +319,7 @@ JS_DEFINE_NATIVE_FUNCTION(GlobalObject::parse_int)
         trimmed_view = trimmed_view.substring_view(1);
 
     // 6. Let R be ℝ(? ToInt32(radix)).
-    auto radix = TRY(vm.argument(1).to_i32(vm));
+    auto radix = TRY(radix_value.to_i32(vm));
 
     // 7. Let stripPrefix be true.
     auto strip_prefix = true;
@@ -384,6 +386,12 @@ JS_DEFINE_NATIVE_FUNCTION(GlobalObject::parse_int)
     return Value(sign * number);
 }
 
+// 19.2.5 parseInt ( string, radix ), https://tc39.es/ecma262/#sec-parseint-string-radix
+JS_DEFINE_NATIVE_FUNCTION(GlobalObject::parse_int)
+{
+    return parse_int_impl(vm, vm.argument(0), vm.argument(1));
+}
+
 // 19.2.6.5 Encode ( string, extraUnescaped ), https://tc39.es/ecma262/#sec-encode
 static ThrowCompletionOr<ByteString> encode(VM& vm, ByteString const& string, StringView unescaped_set)
 {
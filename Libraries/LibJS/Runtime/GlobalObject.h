@@ -24,6 +24,8 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~GlobalObject() override;
 
+    static ThrowCompletionOr<Value> parse_int_impl(VM&, Value string, Value radix);
+
 protected:
     explicit GlobalObject(Realm&);
 
@@ -318,7 +318,10 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_is_finite_function = NativeFunction::create(realm, GlobalObject::is_finite, 1, vm.names.isFinite, &realm);
     m_is_nan_function = NativeFunction::create(realm, GlobalObject::is_nan, 1, vm.names.isNaN, &realm);
     m_parse_float_function = NativeFunction::create(realm, GlobalObject::parse_float, 1, vm.names.parseFloat, &realm);
-    m_parse_int_function = NativeFunction::create(realm, GlobalObject::parse_int, 2, vm.names.parseInt, &realm);
+    auto parse_int_function = NativeFunction::create(realm, GlobalObject::parse_int, 2, vm.names.parseInt, &realm, {}, Bytecode::Builtin::GlobalParseInt);
+    realm.define_builtin(Bytecode::Builtin::GlobalParseInt, parse_int_function);
+    realm.define_builtin(Bytecode::Builtin::NumberParseInt, parse_int_function);
+    m_parse_int_function = parse_int_function;
     m_decode_uri_function = NativeFunction::create(realm, GlobalObject::decode_uri, 1, vm.names.decodeURI, &realm);
     m_decode_uri_component_function = NativeFunction::create(realm, GlobalObject::decode_uri_component, 1, vm.names.decodeURIComponent, &realm);
     m_encode_uri_function = NativeFunction::create(realm, GlobalObject::encode_uri, 1, vm.names.encodeURI, &realm);
@@ -363,6 +366,7 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
     m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
+    m_regexp_prototype_exec_function = &regexp_prototype()->get_without_side_effects(vm.names.exec).as_function();
 
     array_prototype()->convert_to_prototype_if_needed();
     m_default_array_prototype_shape = array_prototype()->shape();
@@ -495,6 +499,7 @@ void Intrinsics::visit_edges(Visitor& visitor)
     visitor.visit(m_json_parse_function);
     visitor.visit(m_json_stringify_function);
     visitor.visit(m_object_prototype_to_string_function);
+    visitor.visit(m_regexp_prototype_exec_function);
     visitor.visit(m_throw_type_error_function);
     visitor.visit(m_throw_type_error_accessor);
 
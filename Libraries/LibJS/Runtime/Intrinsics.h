@@ -102,6 +102,7 @@ public:
     GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
     GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
+    GC::Ref<FunctionObject> regexp_prototype_exec_function() const { return *m_regexp_prototype_exec_function; }
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -239,6 +240,7 @@ private:
     GC::Ptr<FunctionObject> m_json_parse_function;
     GC::Ptr<FunctionObject> m_json_stringify_function;
     GC::Ptr<FunctionObject> m_object_prototype_to_string_function;
+    GC::Ptr<FunctionObject> m_regexp_prototype_exec_function;
     GC::Ptr<FunctionObject> m_throw_type_error_function;
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
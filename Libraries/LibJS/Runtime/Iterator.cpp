@@ -10,6 +10,7 @@
 #include <LibJS/Runtime/AsyncFromSyncIteratorPrototype.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/GeneratorObject.h>
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/VM.h>
 
@@ -302,8 +303,8 @@ static Completion iterator_close_impl(VM& vm, IteratorRecordImpl const& iterator
     // 2. Let iterator be iteratorRecord.[[Iterator]].
     auto iterator = iterator_record.iterator;
 
-    // OPTIMIZATION: "return" method is not defined on any of iterators we treat as built-in.
-    if (iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record.next_method))
+    // OPTIMIZATION: "return" method is not defined on any of iterators we treat as built-in, except for generators.
+    if (!is<GeneratorObject>(*iterator) && iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record.next_method))
         return completion;
 
     // 3. Let innerResult be Completion(GetMethod(iterator, "return")).
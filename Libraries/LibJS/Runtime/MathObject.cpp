@@ -39,17 +39,17 @@ void MathObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.floor, floor, 1, attr, Bytecode::Builtin::MathFloor);
     define_native_function(realm, vm.names.ceil, ceil, 1, attr, Bytecode::Builtin::MathCeil);
     define_native_function(realm, vm.names.round, round, 1, attr, Bytecode::Builtin::MathRound);
-    define_native_function(realm, vm.names.max, max, 2, attr);
-    define_native_function(realm, vm.names.min, min, 2, attr);
-    define_native_function(realm, vm.names.trunc, trunc, 1, attr);
+    define_native_function(realm, vm.names.max, max, 2, attr, Bytecode::Builtin::MathMax);
+    define_native_function(realm, vm.names.min, min, 2, attr, Bytecode::Builtin::MathMin);
+    define_native_function(realm, vm.names.trunc, trunc, 1, attr, Bytecode::Builtin::MathTrunc);
     define_native_function(realm, vm.names.sin, sin, 1, attr, Bytecode::Builtin::MathSin);
     define_native_function(realm, vm.names.cos, cos, 1, attr, Bytecode::Builtin::MathCos);
     define_native_function(realm, vm.names.tan, tan, 1, attr, Bytecode::Builtin::MathTan);
     define_native_function(realm, vm.names.pow, pow, 2, attr, Bytecode::Builtin::MathPow);
     define_native_function(realm, vm.names.exp, exp, 1, attr, Bytecode::Builtin::MathExp);
     define_native_function(realm, vm.names.expm1, expm1, 1, attr);
-    define_native_function(realm, vm.names.sign, sign, 1, attr);
-    define_native_function(realm, vm.names.clz32, clz32, 1, attr);
+    define_native_function(realm, vm.names.sign, sign, 1, attr, Bytecode::Builtin::MathSign);
+    define_native_function(realm, vm.names.clz32, clz32, 1, attr, Bytecode::Builtin::MathClz32);
     define_native_function(realm, vm.names.acos, acos, 1, attr);
     define_native_function(realm, vm.names.acosh, acosh, 1, attr);
     define_native_function(realm, vm.names.asin, asin, 1, attr);
@@ -58,8 +58,8 @@ void MathObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.atanh, atanh, 1, attr);
     define_native_function(realm, vm.names.log1p, log1p, 1, attr);
     define_native_function(realm, vm.names.cbrt, cbrt, 1, attr);
-    define_native_function(realm, vm.names.atan2, atan2, 2, attr);
-    define_native_function(realm, vm.names.fround, fround, 1, attr);
+    define_native_function(realm, vm.names.atan2, atan2, 2, attr, Bytecode::Builtin::MathAtan2);
+    define_native_function(realm, vm.names.fround, fround, 1, attr, Bytecode::Builtin::MathFround);
     define_native_function(realm, vm.names.f16round, f16round, 1, attr);
     define_native_function(realm, vm.names.hypot, hypot, 2, attr);
     define_native_function(realm, vm.names.imul, imul, 2, attr, Bytecode::Builtin::MathImul);
@@ -242,15 +242,15 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::atanh)
 }
 
 // 21.3.2.8 Math.atan2 ( y, x ), https://tc39.es/ecma262/#sec-math.atan2
-JS_DEFINE_NATIVE_FUNCTION(MathObject::atan2)
+ThrowCompletionOr<Value> MathObject::atan2_impl(VM& vm, Value y_argument, Value x_argument)
 {
     auto constexpr three_quarters_pi = M_PI_4 + M_PI_2;
 
     // 1. Let ny be ? ToNumber(y).
-    auto y = TRY(vm.argument(0).to_number(vm));
+    auto y = TRY(y_argument.to_number(vm));
 
     // 2. Let nx be ? ToNumber(x).
-    auto x = TRY(vm.argument(1).to_number(vm));
+    auto x = TRY(x_argument.to_number(vm));
 
     // 3. If ny is NaN or nx is NaN, return NaN.
     if (y.is_nan() || x.is_nan())
@@ -344,6 +344,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::atan2)
     return Value(::atan2(y.as_double(), x.as_double()));
 }
 
+// 21.3.2.8 Math.atan2 ( y, x ), https://tc39.es/ecma262/#sec-math.atan2
+JS_DEFINE_NATIVE_FUNCTION(MathObject::atan2)
+{
+    return atan2_impl(vm, vm.argument(0), vm.argument(1));
+}
+
 // 21.3.2.9 Math.cbrt ( x ), https://tc39.es/ecma262/#sec-math.cbrt
 JS_DEFINE_NATIVE_FUNCTION(MathObject::cbrt)
 {
@@ -361,6 +367,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::cbrt)
 // 21.3.2.10 Math.ceil ( x ), https://tc39.es/ecma262/#sec-math.ceil
 ThrowCompletionOr<Value> MathObject::ceil_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Int32 values are already integral.
+    if (x.is_int32())
+        return x;
+
     // 1. Let n be ? ToNumber(x).
     auto number = TRY(x.to_number(vm));
 
@@ -384,16 +394,26 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::ceil)
 }
 
 // 21.3.2.11 Math.clz32 ( x ), https://tc39.es/ecma262/#sec-math.clz32
-JS_DEFINE_NATIVE_FUNCTION(MathObject::clz32)
+ThrowCompletionOr<Value> MathObject::clz32_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (x.is_int32())
+        return Value(count_leading_zeroes_safe(static_cast<u32>(x.as_i32())));
+
     // 1. Let n be ? ToUint32(x).
-    auto number = TRY(vm.argument(0).to_u32(vm));
+    auto number = TRY(x.to_u32(vm));
 
     // 2. Let p be the number of leading zero bits in the unsigned 32-bit binary representation of n.
     // 3. Return 𝔽(p).
     return Value(count_leading_zeroes_safe(number));
 }
 
+// 21.3.2.11 Math.clz32 ( x ), https://tc39.es/ecma262/#sec-math.clz32
+JS_DEFINE_NATIVE_FUNCTION(MathObject::clz32)
+{
+    return clz32_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.12 Math.cos ( x ), https://tc39.es/ecma262/#sec-math.cos
 ThrowCompletionOr<Value> MathObject::cos_impl(VM& vm, Value value)
 {
@@ -488,6 +508,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::expm1)
 // 21.3.2.16 Math.floor ( x ), https://tc39.es/ecma262/#sec-math.floor
 ThrowCompletionOr<Value> MathObject::floor_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Int32 values are already integral.
+    if (x.is_int32())
+        return x;
+
     // 1. Let n be ? ToNumber(x).
     auto number = TRY(x.to_number(vm));
 
@@ -508,10 +532,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::floor)
 }
 
 // 21.3.2.17 Math.fround ( x ), https://tc39.es/ecma262/#sec-math.fround
-JS_DEFINE_NATIVE_FUNCTION(MathObject::fround)
+ThrowCompletionOr<Value> MathObject::fround_impl(VM& vm, Value x)
 {
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is NaN, return NaN.
     if (number.is_nan())
@@ -527,6 +551,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::fround)
     return Value((float)number.as_double());
 }
 
+// 21.3.2.17 Math.fround ( x ), https://tc39.es/ecma262/#sec-math.fround
+JS_DEFINE_NATIVE_FUNCTION(MathObject::fround)
+{
+    return fround_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.18 Math.f16round ( x ), https://tc39.es/ecma262/#sec-math.f16round
 JS_DEFINE_NATIVE_FUNCTION(MathObject::f16round)
 {
@@ -722,6 +752,41 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::log2)
     return Value(::log2(number.as_double()));
 }
 
+// 21.3.2.25 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
+// NOTE: This is Math.max with exactly two arguments, which is what the CallBuiltin instruction dispatches to.
+ThrowCompletionOr<Value> MathObject::max_impl(VM& vm, Value first, Value second)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (first.is_int32() && second.is_int32())
+        return Value(AK::max(first.as_i32(), second.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //     a. Let n be ? ToNumber(arg).
+    //     b. Append n to coerced.
+    auto first_number = TRY(first.to_number(vm));
+    auto second_number = TRY(second.to_number(vm));
+    Array coerced { first_number, second_number };
+
+    // 3. Let highest be -∞𝔽.
+    auto highest = js_negative_infinity();
+
+    // 4. For each element number of coerced, do
+    for (auto& number : coerced) {
+        // a. If number is NaN, return NaN.
+        if (number.is_nan())
+            return js_nan();
+
+        // b. If number is +0𝔽 and highest is -0𝔽, set highest to +0𝔽.
+        // c. If number > highest, set highest to number.
+        if ((number.is_positive_zero() && highest.is_negative_zero()) || number.as_double() > highest.as_double())
+            highest = number;
+    }
+
+    // 5. Return highest.
+    return highest;
+}
+
 // 21.3.2.25 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
 JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
 {
@@ -756,6 +821,41 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
     return highest;
 }
 
+// 21.3.2.26 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
+// NOTE: This is Math.min with exactly two arguments, which is what the CallBuiltin instruction dispatches to.
+ThrowCompletionOr<Value> MathObject::min_impl(VM& vm, Value first, Value second)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (first.is_int32() && second.is_int32())
+        return Value(AK::min(first.as_i32(), second.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //     a. Let n be ? ToNumber(arg).
+    //     b. Append n to coerced.
+    auto first_number = TRY(first.to_number(vm));
+    auto second_number = TRY(second.to_number(vm));
+    Array coerced { first_number, second_number };
+
+    // 3. Let lowest be +∞𝔽.
+    auto lowest = js_infinity();
+
+    // 4. For each element number of coerced, do
+    for (auto& number : coerced) {
+        // a. If number is NaN, return NaN.
+        if (number.is_nan())
+            return js_nan();
+
+        // b. If number is -0𝔽 and lowest is +0𝔽, set lowest to -0𝔽.
+        // c. If number < lowest, set lowest to number.
+        if ((number.is_negative_zero() && lowest.is_positive_zero()) || number.as_double() < lowest.as_double())
+            lowest = number;
+    }
+
+    // 5. Return lowest.
+    return lowest;
+}
+
 // 21.3.2.26 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
 JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
 {
@@ -872,6 +972,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::random)
 // 21.3.2.29 Math.round ( x ), https://tc39.es/ecma262/#sec-math.round
 ThrowCompletionOr<Value> MathObject::round_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Int32 values are already integral.
+    if (x.is_int32())
+        return x;
+
     // 1. Let n be ? ToNumber(x).
     auto number = TRY(x.to_number(vm));
 
@@ -895,10 +999,16 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::round)
 }
 
 // 21.3.2.30 Math.sign ( x ), https://tc39.es/ecma262/#sec-math.sign
-JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
+ThrowCompletionOr<Value> MathObject::sign_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (x.is_int32()) {
+        auto x_int32 = x.as_i32();
+        return Value((x_int32 > 0) - (x_int32 < 0));
+    }
+
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is one of NaN, +0𝔽, or -0𝔽, return n.
     if (number.is_nan() || number.as_double() == 0)
@@ -912,6 +1022,12 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
     return Value(1);
 }
 
+// 21.3.2.30 Math.sign ( x ), https://tc39.es/ecma262/#sec-math.sign
+JS_DEFINE_NATIVE_FUNCTION(MathObject::sign)
+{
+    return sign_impl(vm, vm.argument(0));
+}
+
 // 21.3.2.31 Math.sin ( x ), https://tc39.es/ecma262/#sec-math.sin
 ThrowCompletionOr<Value> MathObject::sin_impl(VM& vm, Value value)
 {
@@ -1259,10 +1375,14 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::tanh)
 }
 
 // 21.3.2.37 Math.trunc ( x ), https://tc39.es/ecma262/#sec-math.trunc
-JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+ThrowCompletionOr<Value> MathObject::trunc_impl(VM& vm, Value x)
 {
+    // OPTIMIZATION: Int32 values are already integral.
+    if (x.is_int32())
+        return x;
+
     // 1. Let n be ? ToNumber(x).
-    auto number = TRY(vm.argument(0).to_number(vm));
+    auto number = TRY(x.to_number(vm));
 
     // 2. If n is not finite or n is either +0𝔽 or -0𝔽, return n.
     if (number.is_nan() || number.is_infinity() || number.as_double() == 0)
@@ -1276,4 +1396,10 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
             : ::floor(number.as_double()));
 }
 
+// 21.3.2.37 Math.trunc ( x ), https://tc39.es/ecma262/#sec-math.trunc
+JS_DEFINE_NATIVE_FUNCTION(MathObject::trunc)
+{
+    return trunc_impl(vm, vm.argument(0));
+}
+
 }
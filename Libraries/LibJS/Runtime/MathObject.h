@@ -31,6 +31,13 @@ public:
     static ThrowCompletionOr<Value> sin_impl(VM&, Value);
     static ThrowCompletionOr<Value> cos_impl(VM&, Value);
     static ThrowCompletionOr<Value> tan_impl(VM&, Value);
+    static ThrowCompletionOr<Value> trunc_impl(VM&, Value);
+    static ThrowCompletionOr<Value> sign_impl(VM&, Value);
+    static ThrowCompletionOr<Value> clz32_impl(VM&, Value);
+    static ThrowCompletionOr<Value> fround_impl(VM&, Value);
+    static ThrowCompletionOr<Value> atan2_impl(VM&, Value y, Value x);
+    static ThrowCompletionOr<Value> max_impl(VM&, Value, Value);
+    static ThrowCompletionOr<Value> min_impl(VM&, Value, Value);
 
     static Value random_impl();
 
@@ -41,10 +41,10 @@ void NumberConstructor::initialize(Realm& realm)
     define_direct_property(vm.names.prototype, realm.intrinsics().number_prototype(), 0);
 
     u8 attr = Attribute::Writable | Attribute::Configurable;
-    define_native_function(realm, vm.names.isFinite, is_finite, 1, attr);
-    define_native_function(realm, vm.names.isInteger, is_integer, 1, attr);
-    define_native_function(realm, vm.names.isNaN, is_nan, 1, attr);
-    define_native_function(realm, vm.names.isSafeInteger, is_safe_integer, 1, attr);
+    define_native_function(realm, vm.names.isFinite, is_finite, 1, attr, Bytecode::Builtin::NumberIsFinite);
+    define_native_function(realm, vm.names.isInteger, is_integer, 1, attr, Bytecode::Builtin::NumberIsInteger);
+    define_native_function(realm, vm.names.isNaN, is_nan, 1, attr, Bytecode::Builtin::NumberIsNaN);
+    define_native_function(realm, vm.names.isSafeInteger, is_safe_integer, 1, attr, Bytecode::Builtin::NumberIsSafeInteger);
     define_direct_property(vm.names.parseInt, realm.intrinsics().parse_int_function(), attr);
     define_direct_property(vm.names.parseFloat, realm.intrinsics().parse_float_function(), attr);
     define_direct_property(vm.names.EPSILON, Value(EPSILON_VALUE), 0);
@@ -138,19 +138,27 @@ JS_DEFINE_NATIVE_FUNCTION(NumberConstructor::is_nan)
 }
 
 // 21.1.2.5 Number.isSafeInteger ( number ), https://tc39.es/ecma262/#sec-number.issafeinteger
-JS_DEFINE_NATIVE_FUNCTION(NumberConstructor::is_safe_integer)
+bool NumberConstructor::is_safe_integer_impl(Value number)
 {
-    auto number = vm.argument(0);
+    // OPTIMIZATION: All Int32 values are safe integers.
+    if (number.is_int32())
+        return true;
 
     // 1. If IsIntegralNumber(number) is true, then
     if (number.is_integral_number()) {
         // a. If abs(ℝ(number)) ≤ 2^53 - 1, return true.
         if (fabs(number.as_double()) <= MAX_SAFE_INTEGER_VALUE)
-            return Value(true);
+            return true;
     }
 
     // 2. Return false.
-    return Value(false);
+    return false;
+}
+
+// 21.1.2.5 Number.isSafeInteger ( number ), https://tc39.es/ecma262/#sec-number.issafeinteger
+JS_DEFINE_NATIVE_FUNCTION(NumberConstructor::is_safe_integer)
+{
+    return Value(is_safe_integer_impl(vm.argument(0)));
 }
 
 }
@@ -21,6 +21,8 @@ public:
     virtual ThrowCompletionOr<Value> call() override;
     virtual ThrowCompletionOr<GC::Ref<Object>> construct(FunctionObject& new_target) override;
 
+    static bool is_safe_integer_impl(Value);
+
 private:
     explicit NumberConstructor(Realm&);
 
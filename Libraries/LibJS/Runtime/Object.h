@@ -252,6 +252,9 @@ public:
     Value get_direct(size_t index) const { return m_storage[index]; }
     void put_direct(size_t index, Value value) { m_storage[index] = value; }
 
+    // Pre-sizes the backing store for objects that are expected to grow to the given number of named properties.
+    void reserve_named_property_storage(size_t property_count) { m_storage.ensure_capacity(property_count); }
+
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
     void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties = IndexedProperties(move(values)); }
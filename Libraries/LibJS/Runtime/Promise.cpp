@@ -271,12 +271,10 @@ void Promise::trigger_reactions() const
     // 1. For each element reaction of reactions, do
     for (auto& reaction : reactions) {
         // a. Let job be NewPromiseReactionJob(reaction, argument).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Creating PromiseJob for PromiseReaction @ {} with argument {}", this, &reaction, m_result);
-        auto [job, realm] = create_promise_reaction_job(vm, *reaction, m_result);
-
         // b. Perform HostEnqueuePromiseJob(job.[[Job]], job.[[Realm]]).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Enqueuing job @ {} in realm {}", this, &job, realm.ptr());
-        vm.host_enqueue_promise_job(move(job), realm);
+        // OPTIMIZATION: The host queues the reaction and its argument directly, instead of a freshly allocated job closure.
+        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Enqueuing PromiseReaction @ {} with argument {}", this, &reaction, m_result);
+        vm.host_enqueue_promise_reaction_job(*reaction, m_result);
     }
 
     if constexpr (PROMISE_DEBUG) {
@@ -300,8 +298,13 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     //     a. Let onFulfilledJobCallback be empty.
     GC::Ptr<JobCallback> on_fulfilled_job_callback;
 
+    // OPTIMIZATION: If the promise is already settled, only one of the two reactions can ever run, so we don't
+    //               create the job callback and reaction for the other one. This is not observable.
+    bool needs_fulfill_reaction = m_state != State::Rejected;
+    bool needs_reject_reaction = m_state != State::Fulfilled;
+
     // 4. Else,
-    if (on_fulfilled.is_function()) {
+    if (needs_fulfill_reaction && on_fulfilled.is_function()) {
         // a. Let onFulfilledJobCallback be HostMakeJobCallback(onFulfilled).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Creating JobCallback for on_fulfilled function @ {}", this, &on_fulfilled.as_function());
         on_fulfilled_job_callback = vm.host_make_job_callback(on_fulfilled.as_function());
@@ -312,17 +315,21 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     GC::Ptr<JobCallback> on_rejected_job_callback;
 
     // 6. Else,
-    if (on_rejected.is_function()) {
+    if (needs_reject_reaction && on_rejected.is_function()) {
         // a. Let onRejectedJobCallback be HostMakeJobCallback(onRejected).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Creating JobCallback for on_rejected function @ {}", this, &on_rejected.as_function());
         on_rejected_job_callback = vm.host_make_job_callback(on_rejected.as_function());
     }
 
     // 7. Let fulfillReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Fulfill, [[Handler]]: onFulfilledJobCallback }.
-    auto fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, result_capability, move(on_fulfilled_job_callback));
+    GC::Ptr<PromiseReaction> fulfill_reaction;
+    if (needs_fulfill_reaction)
+        fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, result_capability, move(on_fulfilled_job_callback));
 
     // 8. Let rejectReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Reject, [[Handler]]: onRejectedJobCallback }.
-    auto reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
+    GC::Ptr<PromiseReaction> reject_reaction;
+    if (needs_reject_reaction)
+        reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
 
     switch (m_state) {
     // 9. If promise.[[PromiseState]] is pending, then
@@ -330,10 +337,10 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: state is State::Pending, adding fulfill/reject reactions", this);
 
         // a. Append fulfillReaction as the last element of the List that is promise.[[PromiseFulfillReactions]].
-        m_fulfill_reactions.append(fulfill_reaction);
+        m_fulfill_reactions.append(*fulfill_reaction);
 
         // b. Append rejectReaction as the last element of the List that is promise.[[PromiseRejectReactions]].
-        m_reject_reactions.append(reject_reaction);
+        m_reject_reactions.append(*reject_reaction);
         break;
     // 10. Else if promise.[[PromiseState]] is fulfilled, then
     case Promise::State::Fulfilled: {
@@ -341,12 +348,9 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
         auto value = m_result;
 
         // b. Let fulfillJob be NewPromiseReactionJob(fulfillReaction, value).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Fulfilled, creating PromiseJob for PromiseReaction @ {} with argument {}", this, fulfill_reaction.ptr(), value);
-        auto [fulfill_job, realm] = create_promise_reaction_job(vm, fulfill_reaction, value);
-
         // c. Perform HostEnqueuePromiseJob(fulfillJob.[[Job]], fulfillJob.[[Realm]]).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Enqueuing job @ {} in realm {}", this, &fulfill_job, realm.ptr());
-        vm.host_enqueue_promise_job(move(fulfill_job), realm);
+        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Fulfilled, enqueuing PromiseReaction @ {} with argument {}", this, fulfill_reaction.ptr(), value);
+        vm.host_enqueue_promise_reaction_job(*fulfill_reaction, value);
         break;
     }
     // 11. Else,
@@ -361,12 +365,9 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
             vm.host_promise_rejection_tracker(*this, RejectionOperation::Handle);
 
         // d. Let rejectJob be NewPromiseReactionJob(rejectReaction, reason).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Rejected, creating PromiseJob for PromiseReaction @ {} with argument {}", this, reject_reaction.ptr(), reason);
-        auto [reject_job, realm] = create_promise_reaction_job(vm, *reject_reaction, reason);
-
         // e. Perform HostEnqueuePromiseJob(rejectJob.[[Job]], rejectJob.[[Realm]]).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: Enqueuing job @ {} in realm {}", this, &reject_job, realm.ptr());
-        vm.host_enqueue_promise_job(move(reject_job), realm);
+        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: State is State::Rejected, enqueuing PromiseReaction @ {} with argument {}", this, reject_reaction.ptr(), reason);
+        vm.host_enqueue_promise_reaction_job(*reject_reaction, reason);
         break;
     }
     default:
@@ -17,7 +17,7 @@
 namespace JS {
 
 // 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
-static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
+ThrowCompletionOr<Value> run_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
 {
     // a. Let promiseCapability be reaction.[[Capability]].
     auto promise_capability = reaction.capability();
@@ -32,11 +32,11 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
 
     // d. If handler is empty, then
     if (!handler) {
-        dbgln_if(PROMISE_DEBUG, "run_reaction_job: Handler is empty");
+        dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Handler is empty");
 
         // i. If type is Fulfill, let handlerResult be NormalCompletion(argument).
         if (type == PromiseReaction::Type::Fulfill) {
-            dbgln_if(PROMISE_DEBUG, "run_reaction_job: Reaction type is Type::Fulfill, setting handler result to {}", argument);
+            dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Reaction type is Type::Fulfill, setting handler result to {}", argument);
             handler_result = normal_completion(argument);
         }
         // ii. Else,
@@ -45,13 +45,13 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
             VERIFY(type == PromiseReaction::Type::Reject);
 
             // 2. Let handlerResult be ThrowCompletion(argument).
-            dbgln_if(PROMISE_DEBUG, "run_reaction_job: Reaction type is Type::Reject, throwing exception with argument {}", argument);
+            dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Reaction type is Type::Reject, throwing exception with argument {}", argument);
             handler_result = throw_completion(argument);
         }
     }
     // e. Else, let handlerResult be Completion(HostCallJobCallback(handler, undefined, « argument »)).
     else {
-        dbgln_if(PROMISE_DEBUG, "run_reaction_job: Calling handler callback {} @ {} with argument {}", handler->callback().class_name(), &handler->callback(), argument);
+        dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Calling handler callback {} @ {} with argument {}", handler->callback().class_name(), &handler->callback(), argument);
         handler_result = vm.host_call_job_callback(*handler, js_undefined(), ReadonlySpan<Value> { &argument, 1 });
     }
 
@@ -61,7 +61,7 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
         MUST_OR_THROW_INTERNAL_ERROR(handler_result);
 
         // ii. Return empty.
-        dbgln_if(PROMISE_DEBUG, "run_reaction_job: Reaction has no PromiseCapability, returning empty value");
+        dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Reaction has no PromiseCapability, returning empty value");
         return js_undefined();
     }
 
@@ -71,7 +71,7 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
     if (handler_result.is_abrupt()) {
         // i. Return ? Call(promiseCapability.[[Reject]], undefined, « handlerResult.[[Value]] »).
         auto reject_function = promise_capability->reject();
-        dbgln_if(PROMISE_DEBUG, "run_reaction_job: Calling PromiseCapability's reject function @ {}", reject_function.ptr());
+        dbgln_if(PROMISE_DEBUG, "run_promise_reaction_job: Calling PromiseCapability's reject function @ {}", reject_function.ptr());
         return call(vm, *reject_function, js_undefined(), handler_result.value());
     }
     // i. Else,
@@ -84,14 +84,8 @@ static ThrowCompletionOr<Value> run_reaction_job(VM& vm, PromiseReaction& reacti
 }
 
 // 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
-PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
+Realm* promise_reaction_job_realm(VM& vm, PromiseReaction& reaction)
 {
-    // 1. Let job be a new Job Abstract Closure with no parameters that captures reaction and argument and performs the following steps when called:
-    //    See run_reaction_job for "the following steps".
-    auto job = GC::create_function(vm.heap(), [&vm, &reaction, argument] {
-        return run_reaction_job(vm, reaction, argument);
-    });
-
     // 2. Let handlerRealm be null.
     Realm* handler_realm { nullptr };
 
@@ -112,6 +106,21 @@ PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value
         // d. NOTE: handlerRealm is never null unless the handler is undefined. When the handler is a revoked Proxy and no ECMAScript code runs, handlerRealm is used to create error objects.
     }
 
+    return handler_realm;
+}
+
+// 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
+PromiseJob create_promise_reaction_job(VM& vm, PromiseReaction& reaction, Value argument)
+{
+    // 1. Let job be a new Job Abstract Closure with no parameters that captures reaction and argument and performs the following steps when called:
+    //    See run_promise_reaction_job for "the following steps".
+    auto job = GC::create_function(vm.heap(), [&vm, &reaction, argument] {
+        return run_promise_reaction_job(vm, reaction, argument);
+    });
+
+    // 2-3. See promise_reaction_job_realm for computing handlerRealm.
+    auto* handler_realm = promise_reaction_job_realm(vm, reaction);
+
     // 4. Return the Record { [[Job]]: job, [[Realm]]: handlerRealm }.
     return { job, handler_realm };
 }
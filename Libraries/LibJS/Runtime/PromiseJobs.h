@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -23,4 +24,9 @@ struct PromiseJob {
 PromiseJob create_promise_reaction_job(VM&, PromiseReaction&, Value argument);
 PromiseJob create_promise_resolve_thenable_job(VM&, Promise&, Value thenable, GC::Ref<JobCallback> then);
 
+// NOTE: These run the steps of the job created by NewPromiseReactionJob and return its realm, for hosts that queue the
+//       reaction directly.
+JS_API ThrowCompletionOr<Value> run_promise_reaction_job(VM&, PromiseReaction&, Value argument);
+JS_API Realm* promise_reaction_job_realm(VM&, PromiseReaction&);
+
 }
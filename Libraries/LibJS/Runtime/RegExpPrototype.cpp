@@ -171,7 +171,10 @@ static Value make_match_indices_index_pair_array(VM& vm, Utf16View const& string
 
 // 22.2.7.2 RegExpBuiltinExec ( R, S ), https://tc39.es/ecma262/#sec-regexpbuiltinexec
 // 22.2.7.2 RegExpBuiltInExec ( R, S ), https://github.com/tc39/proposal-regexp-legacy-features#regexpbuiltinexec--r-s-
-static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp_object, GC::Ref<PrimitiveString> string)
+// NOTE: These are the steps of RegExpBuiltinExec up to the creation of the result array A, together with the update of the
+//       legacy static properties, which has no observable interaction with creating A. Returns the Match Record
+//       { [[StartIndex]]: lastIndex, [[EndIndex]]: e }, or an empty Optional if RegExpBuiltinExec would return null.
+static ThrowCompletionOr<Optional<Match>> regexp_builtin_exec_match(VM& vm, RegExpObject& regexp_object, PrimitiveString& string, RegexResult& result)
 {
     auto& realm = *vm.current_realm();
 
@@ -188,8 +191,6 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     bool global = regex.options().has_flag_set(ECMAScriptFlags::Global);
     // 5. If flags contains "y", let sticky be true; else let sticky be false.
     bool sticky = regex.options().has_flag_set(ECMAScriptFlags::Sticky);
-    // 6. If flags contains "d", let hasIndices be true, else let hasIndices be false.
-    bool has_indices = regexp_object.flags().contains('d');
 
     // 7. If global is false and sticky is false, set lastIndex to 0.
     if (!global && !sticky)
@@ -200,8 +201,6 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     // 9. If flags contains "u" or flags contains "v", let fullUnicode be true; else let fullUnicode be false.
     bool full_unicode = regex.options().has_flag_set(ECMAScriptFlags::Unicode) || regex.options().has_flag_set(ECMAScriptFlags::UnicodeSets);
 
-    RegexResult result;
-
     // NOTE: For optimisation purposes, this whole loop is implemented in LibRegex.
     // 10. Let matchSucceeded be false.
     // 11. If fullUnicode is true, let input be StringToCodePoints(S). Otherwise, let input be a List whose elements are the code units that are the elements of S.
@@ -223,20 +222,20 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     //       ii. Set matchSucceeded to true.
 
     // 13.b and 13.c
-    regex.start_offset = full_unicode && last_index <= string->length_in_utf16_code_units()
-        ? string->utf16_string_view().code_point_offset_of(last_index)
+    regex.start_offset = full_unicode && last_index <= string.length_in_utf16_code_units()
+        ? string.utf16_string_view().code_point_offset_of(last_index)
         : last_index;
 
-    result = regex.match(string->utf16_string_view());
+    result = regex.match(string.utf16_string_view());
 
     // 13.d and 13.a
-    if (!result.success || last_index > string->length_in_utf16_code_units()) {
+    if (!result.success || last_index > string.length_in_utf16_code_units()) {
         // 13.d.i, 13.a.i
         if (sticky || global)
             TRY(regexp_object.set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
 
         // 13.a.ii, 13.d.i.2
-        return js_null();
+        return Optional<Match> {};
     }
 
     auto& match = result.matches[0];
@@ -248,8 +247,8 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
 
     // 15. If fullUnicode is true, set e to ! GetStringIndex(S, Input, e).
     if (full_unicode) {
-        match_index = string->utf16_string_view().code_unit_offset_of(match.global_offset);
-        end_index = string->utf16_string_view().code_unit_offset_of(end_index);
+        match_index = string.utf16_string_view().code_unit_offset_of(match.global_offset);
+        end_index = string.utf16_string_view().code_unit_offset_of(end_index);
     }
 
     // 16. If global is true or sticky is true, then
@@ -263,13 +262,55 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     // 19. Assert: n < 2^32 - 1.
     VERIFY(result.n_named_capture_groups < NumericLimits<u32>::max());
 
+    // https://github.com/tc39/proposal-regexp-legacy-features#regexpbuiltinexec--r-s-
+    // 5. Let thisRealm be the current Realm Record.
+    auto* this_realm = &realm;
+    // 6. Let rRealm be the value of R's [[Realm]] internal slot.
+    auto* regexp_object_realm = &regexp_object.realm();
+    // 7. If SameValue(thisRealm, rRealm) is true, then
+    if (this_realm == regexp_object_realm) {
+        // i. If the value of R’s [[LegacyFeaturesEnabled]] internal slot is true, then
+        if (regexp_object.legacy_features_enabled()) {
+            Vector<Utf16String> captured_values;
+            captured_values.ensure_capacity(result.n_capture_groups);
+            for (size_t i = 1; i <= result.n_capture_groups; ++i) {
+                auto& capture = result.capture_group_matches[0][i - 1];
+                captured_values.unchecked_append(capture.view.is_null() ? Utf16String {} : Utf16String::from_utf16(capture.view.u16_view()));
+            }
+
+            // a. Perform UpdateLegacyRegExpStaticProperties(%RegExp%, S, lastIndex, e, capturedValues).
+            auto match_indices = Match::create(match);
+            update_legacy_regexp_static_properties(realm.intrinsics().regexp_constructor(), string.utf16_string(), match_indices.start_index, match_indices.end_index, captured_values);
+        }
+        // ii. Else,
+        else {
+            // a. Perform InvalidateLegacyRegExpStaticProperties(%RegExp%).
+            invalidate_legacy_regexp_static_properties(realm.intrinsics().regexp_constructor());
+        }
+    }
+
+    return Match { match_index, end_index };
+}
+
+// 22.2.7.2 RegExpBuiltinExec ( R, S ), https://tc39.es/ecma262/#sec-regexpbuiltinexec
+// NOTE: These are the remaining steps of RegExpBuiltinExec after a successful regexp_builtin_exec_match().
+static GC::Ref<Array> create_regexp_builtin_exec_result(VM& vm, RegExpObject& regexp_object, GC::Ref<PrimitiveString> string, RegexResult const& result, Match const& match_record)
+{
+    auto& realm = *vm.current_realm();
+    auto const& regex = regexp_object.regex();
+
+    auto& match = result.matches[0];
+
+    // 6. If flags contains "d", let hasIndices be true, else let hasIndices be false.
+    bool has_indices = regexp_object.flags().contains('d');
+
     // 20. Let A be ! ArrayCreate(n + 1).
     auto array = MUST(Array::create(realm, result.n_named_capture_groups + 1));
 
     // 21. Assert: The mathematical value of A's "length" property is n + 1.
 
     // 22. Perform ! CreateDataPropertyOrThrow(A, "index", 𝔽(lastIndex)).
-    MUST(array->create_data_property_or_throw(vm.names.index, Value(match_index)));
+    MUST(array->create_data_property_or_throw(vm.names.index, Value(match_record.start_index)));
 
     // 23. Perform ! CreateDataPropertyOrThrow(A, "input", S).
     MUST(array->create_data_property_or_throw(vm.names.input, string));
@@ -304,7 +345,6 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
 
     // 33. Let matchedGroupNames be a new empty List.
     Vector<Utf16FlyString> matched_group_names;
-    Vector<Utf16String> captured_values;
 
     // 34. For each integer i such that 1 ≤ i ≤ n, in ascending order, do
     for (size_t i = 1; i <= result.n_capture_groups; ++i) {
@@ -320,7 +360,6 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
             captured_value = js_undefined();
             // ii. Append undefined to indices.
             indices.append({});
-            captured_values.append({});
         }
         // c. Else,
         else {
@@ -331,11 +370,9 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
             //     2. Set captureEnd to GetStringIndex(S, captureEnd).
             // iv. Let capture be the Match Record { [[StartIndex]]: captureStart, [[EndIndex]]: captureEnd }.
             // v. Let capturedValue be GetMatchString(S, capture).
-            auto capture_as_utf16_string = Utf16String::from_utf16(capture.view.u16_view());
-            captured_value = PrimitiveString::create(vm, capture_as_utf16_string);
+            captured_value = PrimitiveString::create(vm, capture.view.u16_view());
             // vi. Append capture to indices.
             indices.append(Match::create(capture));
-            captured_values.append(capture_as_utf16_string);
         }
 
         // d. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(i)), capturedValue).
@@ -388,25 +425,6 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
         MUST(array->set(vm.names.groups, groups, Object::ShouldThrowExceptions::Yes));
     }
 
-    // https://github.com/tc39/proposal-regexp-legacy-features#regexpbuiltinexec--r-s-
-    // 5. Let thisRealm be the current Realm Record.
-    auto* this_realm = &realm;
-    // 6. Let rRealm be the value of R's [[Realm]] internal slot.
-    auto* regexp_object_realm = &regexp_object.realm();
-    // 7. If SameValue(thisRealm, rRealm) is true, then
-    if (this_realm == regexp_object_realm) {
-        // i. If the value of R’s [[LegacyFeaturesEnabled]] internal slot is true, then
-        if (regexp_object.legacy_features_enabled()) {
-            // a. Perform UpdateLegacyRegExpStaticProperties(%RegExp%, S, lastIndex, e, capturedValues).
-            update_legacy_regexp_static_properties(realm.intrinsics().regexp_constructor(), string->utf16_string(), match_indices.start_index, match_indices.end_index, captured_values);
-        }
-        // ii. Else,
-        else {
-            // a. Perform InvalidateLegacyRegExpStaticProperties(%RegExp%).
-            invalidate_legacy_regexp_static_properties(realm.intrinsics().regexp_constructor());
-        }
-    }
-
     // 35. If hasIndices is true, then
     if (has_indices) {
         // a. Let indicesArray be MakeMatchIndicesIndexPairArray(S, indices, groupNames, hasGroups).
@@ -443,13 +461,21 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     return array;
 }
 
-// 22.2.7.1 RegExpExec ( R, S ), https://tc39.es/ecma262/#sec-regexpexec
-ThrowCompletionOr<Value> regexp_exec(VM& vm, Object& regexp_object, GC::Ref<PrimitiveString> string)
+// 22.2.7.2 RegExpBuiltinExec ( R, S ), https://tc39.es/ecma262/#sec-regexpbuiltinexec
+static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp_object, GC::Ref<PrimitiveString> string)
 {
-    // 1. Let exec be ? Get(R, "exec").
-    static Bytecode::PropertyLookupCache cache;
-    auto exec = TRY(regexp_object.get(vm.names.exec, cache));
+    RegexResult result;
+    auto match_record = TRY(regexp_builtin_exec_match(vm, regexp_object, string, result));
+    if (!match_record.has_value())
+        return js_null();
+
+    return create_regexp_builtin_exec_result(vm, regexp_object, string, result, *match_record);
+}
 
+// 22.2.7.1 RegExpExec ( R, S ), https://tc39.es/ecma262/#sec-regexpexec
+// NOTE: These are steps 2-4, for callers that have already looked up exec in step 1.
+static ThrowCompletionOr<Value> call_regexp_exec(VM& vm, Object& regexp_object, GC::Ref<PrimitiveString> string, Value exec)
+{
     // 2. If IsCallable(exec) is true, then
     if (exec.is_function()) {
         // a. Let result be ? Call(exec, R, « S »).
@@ -471,6 +497,66 @@ ThrowCompletionOr<Value> regexp_exec(VM& vm, Object& regexp_object, GC::Ref<Prim
     return regexp_builtin_exec(vm, static_cast<RegExpObject&>(regexp_object), string);
 }
 
+// 22.2.7.1 RegExpExec ( R, S ), https://tc39.es/ecma262/#sec-regexpexec
+ThrowCompletionOr<Value> regexp_exec(VM& vm, Object& regexp_object, GC::Ref<PrimitiveString> string)
+{
+    // 1. Let exec be ? Get(R, "exec").
+    static Bytecode::PropertyLookupCache cache;
+    auto exec = TRY(regexp_object.get(vm.names.exec, cache));
+
+    // 2-4.
+    return call_regexp_exec(vm, regexp_object, string, exec);
+}
+
+// Non-standard: A successful match by %RegExp.prototype.exec%, in place of its result array.
+struct BuiltinExecMatch {
+    Match match;
+    Vector<Optional<Utf16View>, 4> captures;
+};
+
+using RegExpExecResult = Variant<GC::Ref<Object>, BuiltinExecMatch>;
+
+// Non-standard: RegExpExec ( R, S ), for callers that only read the "0", "index", "length" and capture properties of the
+// result. Returns an empty Optional where RegExpExec would return null.
+static ThrowCompletionOr<Optional<RegExpExecResult>> regexp_exec_without_result_array(VM& vm, Object& regexp_object, GC::Ref<PrimitiveString> string)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. Let exec be ? Get(R, "exec").
+    static Bytecode::PropertyLookupCache cache;
+    auto exec = TRY(regexp_object.get(vm.names.exec, cache));
+
+    // OPTIMIZATION: If exec is %RegExp.prototype.exec%, the only observable part of calling it is RegExpBuiltinExec's
+    //               matching itself, since the result array is a fresh object with only data properties. So we run the
+    //               match directly, and hand out the match indices and capture views instead of creating that array.
+    //               Matches with named groups still get the array, as callers need "groups" as an object.
+    if (exec.is_object() && &exec.as_object() == realm.intrinsics().regexp_prototype_exec_function().ptr() && is<RegExpObject>(regexp_object)) {
+        auto& builtin_regexp_object = static_cast<RegExpObject&>(regexp_object);
+
+        RegexResult result;
+        auto match_record = TRY(regexp_builtin_exec_match(vm, builtin_regexp_object, string, result));
+        if (!match_record.has_value())
+            return OptionalNone {};
+
+        if (result.n_named_capture_groups != 0)
+            return RegExpExecResult { create_regexp_builtin_exec_result(vm, builtin_regexp_object, string, result, *match_record) };
+
+        BuiltinExecMatch builtin_match { .match = *match_record, .captures = {} };
+        builtin_match.captures.ensure_capacity(result.n_capture_groups);
+        for (size_t i = 0; i < result.n_capture_groups; ++i) {
+            auto const& capture = result.capture_group_matches[0][i];
+            builtin_match.captures.unchecked_append(capture.view.is_null() ? Optional<Utf16View> {} : capture.view.u16_view());
+        }
+        return RegExpExecResult { move(builtin_match) };
+    }
+
+    // 2-4.
+    auto result = TRY(call_regexp_exec(vm, regexp_object, string, exec));
+    if (result.is_null())
+        return OptionalNone {};
+    return RegExpExecResult { result.as_object() };
+}
+
 // 22.2.7.3 AdvanceStringIndex ( S, index, unicode ), https://tc39.es/ecma262/#sec-advancestringindex
 size_t advance_string_index(Utf16View const& string, size_t index, bool unicode)
 {
@@ -616,10 +702,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match)
     // e. Repeat,
     while (true) {
         // i. Let result be ? RegExpExec(rx, S).
-        auto result_value = TRY(regexp_exec(vm, regexp_object, string));
+        auto result = TRY(regexp_exec_without_result_array(vm, regexp_object, string));
 
         // ii. If result is null, then
-        if (result_value.is_null()) {
+        if (!result.has_value()) {
             // 1. If n = 0, return null.
             if (n == 0)
                 return js_null();
@@ -628,20 +714,23 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match)
             return array;
         }
 
-        VERIFY(result_value.is_object());
-        auto& result = result_value.as_object();
-
         // iii. Else,
 
         // 1. Let matchStr be ? ToString(? Get(result, "0")).
-        auto match_value = TRY(result.get(0));
-        auto match_str = TRY(match_value.to_string(vm));
+        GC::Ptr<PrimitiveString> match_str;
+        if (auto const* builtin_match = result->get_pointer<BuiltinExecMatch>()) {
+            auto const& [start_index, end_index] = builtin_match->match;
+            match_str = PrimitiveString::create(vm, string->utf16_string_view().substring_view(start_index, end_index - start_index));
+        } else {
+            auto match_value = TRY(result->get<GC::Ref<Object>>()->get(0));
+            match_str = TRY(match_value.to_primitive_string(vm));
+        }
 
         // 2. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(n)), matchStr).
-        MUST(array->create_data_property_or_throw(n, PrimitiveString::create(vm, match_str)));
+        MUST(array->create_data_property_or_throw(n, match_str));
 
         // 3. If matchStr is the empty String, then
-        if (match_str.is_empty()) {
+        if (match_str->is_empty()) {
             // Steps 3a-3c are implemented by increment_last_index.
             TRY(increment_last_index(vm, regexp_object, string->utf16_string_view(), full_unicode));
         }
@@ -734,22 +823,26 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
     }
 
     // 10. Let results be a new empty List.
-    GC::RootVector<Object*> results(vm.heap());
+    // NOTE: Result arrays are kept alive by result_objects, as results itself is not visible to the GC.
+    Vector<RegExpExecResult> results;
+    GC::RootVector<Object*> result_objects(vm.heap());
 
     // 11. Let done be false.
     // 12. Repeat, while done is false,
     while (true) {
         // a. Let result be ? RegExpExec(rx, S).
-        auto result = TRY(regexp_exec(vm, regexp_object, string));
+        auto result = TRY(regexp_exec_without_result_array(vm, regexp_object, string));
 
         // b. If result is null, set done to true.
-        if (result.is_null())
+        if (!result.has_value())
             break;
 
         // c. Else,
 
         // i. Append result to the end of results.
-        results.append(&result.as_object());
+        if (auto const* result_object = result->get_pointer<GC::Ref<Object>>())
+            result_objects.append(result_object->ptr());
+        results.append(result.release_value());
 
         // ii. If global is false, set done to true.
         if (!global)
@@ -758,11 +851,16 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
         // iii. Else,
 
         // 1. Let matchStr be ? ToString(? Get(result, "0")).
-        auto match_value = TRY(result.get(vm, 0));
-        auto match_str = TRY(match_value.to_string(vm));
+        bool match_str_is_empty;
+        if (auto const* builtin_match = results.last().get_pointer<BuiltinExecMatch>()) {
+            match_str_is_empty = builtin_match->match.start_index == builtin_match->match.end_index;
+        } else {
+            auto match_value = TRY(results.last().get<GC::Ref<Object>>()->get(0));
+            match_str_is_empty = TRY(match_value.to_string(vm)).is_empty();
+        }
 
         // 2. If matchStr is the empty String, then
-        if (match_str.is_empty()) {
+        if (match_str_is_empty) {
             // b. If flags contains "u" or flags contains "v", let fullUnicode be true. Otherwise, let fullUnicode be false.
             bool full_unicode = flags.contains('u') || flags.contains('v');
 
@@ -777,54 +875,79 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
     // 14. Let nextSourcePosition be 0.
     size_t next_source_position = 0;
 
+    // NOTE: Captures of builtin exec matches are only turned into strings if the replacement can refer to them.
+    bool replacement_uses_captures = replace_value.is_function() || replace_value.as_string().utf16_string_view().contains(u'$');
+
     // 15. For each element result of results, do
     for (auto& result : results) {
-        // a. Let resultLength be ? LengthOfArrayLike(result).
-        size_t result_length = TRY(length_of_array_like(vm, *result));
+        Utf16View matched;
+        GC::Ptr<PrimitiveString> matched_string;
+        double position = 0;
+        GC::RootVector<Value> captures(vm.heap());
+        Value named_captures = js_undefined();
+
+        // OPTIMIZATION: For a builtin exec match, steps a-j read nothing but the data properties of a result array that was
+        //               never created, so we take the same values straight from the match.
+        if (auto const* builtin_match = result.get_pointer<BuiltinExecMatch>()) {
+            auto const& [start_index, end_index] = builtin_match->match;
+            matched = string->utf16_string_view().substring_view(start_index, end_index - start_index);
+            position = start_index;
+
+            if (replacement_uses_captures) {
+                for (auto const& capture : builtin_match->captures)
+                    captures.append(capture.has_value() ? Value { PrimitiveString::create(vm, *capture) } : js_undefined());
+            }
+        } else {
+            auto& result_object = *result.get<GC::Ref<Object>>();
 
-        // b. Let nCaptures be max(resultLength - 1, 0).
-        size_t n_captures = result_length == 0 ? 0 : result_length - 1;
+            // a. Let resultLength be ? LengthOfArrayLike(result).
+            size_t result_length = TRY(length_of_array_like(vm, result_object));
 
-        // c. Let matched be ? ToString(? Get(result, "0")).
-        auto matched_value = TRY(result->get(0));
-        auto matched = TRY(matched_value.to_primitive_string(vm));
+            // b. Let nCaptures be max(resultLength - 1, 0).
+            size_t n_captures = result_length == 0 ? 0 : result_length - 1;
 
-        // d. Let matchLength be the length of matched.
-        auto matched_length = matched->length_in_utf16_code_units();
+            // c. Let matched be ? ToString(? Get(result, "0")).
+            auto matched_value = TRY(result_object.get(0));
+            matched_string = TRY(matched_value.to_primitive_string(vm));
+            matched = matched_string->utf16_string_view();
 
-        // e. Let position be ? ToIntegerOrInfinity(? Get(result, "index")).
-        static Bytecode::PropertyLookupCache cache2;
-        auto position_value = TRY(result->get(vm.names.index, cache2));
-        double position = TRY(position_value.to_integer_or_infinity(vm));
+            // d. Let matchLength be the length of matched.
 
-        // f. Set position to the result of clamping position between 0 and lengthS.
-        position = clamp(position, static_cast<double>(0), static_cast<double>(string->length_in_utf16_code_units()));
+            // e. Let position be ? ToIntegerOrInfinity(? Get(result, "index")).
+            static Bytecode::PropertyLookupCache cache2;
+            auto position_value = TRY(result_object.get(vm.names.index, cache2));
+            position = TRY(position_value.to_integer_or_infinity(vm));
 
-        // g. Let captures be a new empty List.
-        GC::RootVector<Value> captures(vm.heap());
+            // f. Set position to the result of clamping position between 0 and lengthS.
+            position = clamp(position, static_cast<double>(0), static_cast<double>(string->length_in_utf16_code_units()));
 
-        // h. Let n be 1.
-        // i. Repeat, while n ≤ nCaptures,
-        for (size_t n = 1; n <= n_captures; ++n) {
-            // i. Let capN be ? Get(result, ! ToString(𝔽(n))).
-            auto capture = TRY(result->get(n));
+            // g. Let captures be a new empty List.
 
-            // ii. If capN is not undefined, then
-            if (!capture.is_undefined()) {
-                // 1. Set capN to ? ToString(capN).
-                capture = PrimitiveString::create(vm, TRY(capture.to_string(vm)));
-            }
+            // h. Let n be 1.
+            // i. Repeat, while n ≤ nCaptures,
+            for (size_t n = 1; n <= n_captures; ++n) {
+                // i. Let capN be ? Get(result, ! ToString(𝔽(n))).
+                auto capture = TRY(result_object.get(n));
+
+                // ii. If capN is not undefined, then
+                if (!capture.is_undefined()) {
+                    // 1. Set capN to ? ToString(capN).
+                    capture = PrimitiveString::create(vm, TRY(capture.to_string(vm)));
+                }
 
-            // iii. Append capN as the last element of captures.
-            captures.append(move(capture));
+                // iii. Append capN as the last element of captures.
+                captures.append(move(capture));
 
-            // iv. NOTE: When n = 1, the preceding step puts the first element into captures (at index 0). More generally, the nth capture (the characters captured by the nth set of capturing parentheses) is at captures[n - 1].
-            // v. Set n to n + 1.
+                // iv. NOTE: When n = 1, the preceding step puts the first element into captures (at index 0). More generally, the nth capture (the characters captured by the nth set of capturing parentheses) is at captures[n - 1].
+                // v. Set n to n + 1.
+            }
+
+            // j. Let namedCaptures be ? Get(result, "groups").
+            static Bytecode::PropertyLookupCache cache3;
+            named_captures = TRY(result_object.get(vm.names.groups, cache3));
         }
 
-        // j. Let namedCaptures be ? Get(result, "groups").
-        static Bytecode::PropertyLookupCache cache3;
-        auto named_captures = TRY(result->get(vm.names.groups, cache3));
+        auto matched_length = matched.length_in_code_units();
 
         String replacement;
 
@@ -832,7 +955,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
         if (replace_value.is_function()) {
             // i. Let replacerArgs be the list-concatenation of « matched », captures, and « 𝔽(position), S ».
             GC::RootVector<Value> replacer_args(vm.heap());
-            replacer_args.append(matched);
+            replacer_args.append(matched_string ? GC::Ref { *matched_string } : PrimitiveString::create(vm, matched));
             replacer_args.extend(move(captures));
             replacer_args.append(Value(position));
             replacer_args.append(string);
@@ -858,7 +981,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
             }
 
             // ii. Let replacement be ? GetSubstitution(matched, S, position, captures, namedCaptures, replaceValue).
-            replacement = TRY(get_substitution(vm, matched->utf16_string_view(), string->utf16_string_view(), position, captures, named_captures, replace_value));
+            replacement = TRY(get_substitution(vm, matched, string->utf16_string_view(), position, captures, named_captures, replace_value));
         }
 
         // m. If position ≥ nextSourcePosition, then
@@ -907,7 +1030,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_search)
     }
 
     // 6. Let result be ? RegExpExec(rx, S).
-    auto result = TRY(regexp_exec(vm, regexp_object, string));
+    auto result = TRY(regexp_exec_without_result_array(vm, regexp_object, string));
 
     // 7. Let currentLastIndex be ? Get(rx, "lastIndex").
     static Bytecode::PropertyLookupCache cache2;
@@ -920,12 +1043,14 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_search)
     }
 
     // 9. If result is null, return -1𝔽.
-    if (result.is_null())
+    if (!result.has_value())
         return Value(-1);
 
     // 10. Return ? Get(result, "index").
+    if (auto const* builtin_match = result->get_pointer<BuiltinExecMatch>())
+        return Value(builtin_match->match.start_index);
     static Bytecode::PropertyLookupCache cache3;
-    return TRY(result.get(vm, vm.names.index, cache3));
+    return TRY(result->get<GC::Ref<Object>>()->get(vm.names.index, cache3));
 }
 
 // 22.2.6.13 get RegExp.prototype.source, https://tc39.es/ecma262/#sec-get-regexp.prototype.source
@@ -1003,10 +1128,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
     // 15. If S is the empty String, then
     if (string->is_empty()) {
         // a. Let z be ? RegExpExec(splitter, S).
-        auto result = TRY(regexp_exec(vm, splitter, string));
+        auto result = TRY(regexp_exec_without_result_array(vm, splitter, string));
 
         // b. If z is not null, return A.
-        if (!result.is_null())
+        if (result.has_value())
             return array;
 
         // c. Perform ! CreateDataPropertyOrThrow(A, "0", S).
@@ -1030,10 +1155,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
         TRY(splitter->set(vm.names.lastIndex, Value(next_search_from), Object::ShouldThrowExceptions::Yes));
 
         // b. Let z be ? RegExpExec(splitter, S).
-        auto result = TRY(regexp_exec(vm, splitter, string));
+        auto result = TRY(regexp_exec_without_result_array(vm, splitter, string));
 
         // c. If z is null, set q to AdvanceStringIndex(S, q, unicodeMatching).
-        if (result.is_null()) {
+        if (!result.has_value()) {
             next_search_from = advance_string_index(string->utf16_string_view(), next_search_from, unicode_matching);
             continue;
         }
@@ -1072,18 +1197,30 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
         // 5. Set p to e.
         last_match_end = last_index;
 
-        // 6. Let numberOfCaptures be ? LengthOfArrayLike(z).
-        auto number_of_captures = TRY(length_of_array_like(vm, result.as_object()));
+        auto const* builtin_match = result->get_pointer<BuiltinExecMatch>();
 
+        // 6. Let numberOfCaptures be ? LengthOfArrayLike(z).
         // 7. Set numberOfCaptures to max(numberOfCaptures - 1, 0).
-        if (number_of_captures > 0)
-            --number_of_captures;
+        size_t number_of_captures = 0;
+        if (builtin_match) {
+            number_of_captures = builtin_match->captures.size();
+        } else {
+            number_of_captures = TRY(length_of_array_like(vm, result->get<GC::Ref<Object>>()));
+            if (number_of_captures > 0)
+                --number_of_captures;
+        }
 
         // 8. Let i be 1.
         // 9. Repeat, while i ≤ numberOfCaptures,
         for (size_t i = 1; i <= number_of_captures; ++i) {
             // a. Let nextCapture be ? Get(z, ! ToString(𝔽(i))).
-            auto next_capture = TRY(result.get(vm, i));
+            Value next_capture;
+            if (builtin_match) {
+                auto const& capture = builtin_match->captures[i - 1];
+                next_capture = capture.has_value() ? Value { PrimitiveString::create(vm, *capture) } : js_undefined();
+            } else {
+                next_capture = TRY(result->get<GC::Ref<Object>>()->get(i));
+            }
 
             // b. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(lengthA)), nextCapture).
             MUST(array->create_data_property_or_throw(array_length, next_capture));
@@ -1123,10 +1260,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::test)
     auto string = TRY(vm.argument(0).to_primitive_string(vm));
 
     // 4. Let match be ? RegExpExec(R, string).
-    auto match = TRY(regexp_exec(vm, regexp_object, string));
+    auto match = TRY(regexp_exec_without_result_array(vm, regexp_object, string));
 
     // 5. If match is not null, return true; else return false.
-    return Value(!match.is_null());
+    return Value(match.has_value());
 }
 
 // 22.2.6.17 RegExp.prototype.toString ( ), https://tc39.es/ecma262/#sec-regexp.prototype.tostring
@@ -90,6 +90,10 @@ public:
     size_t m_var_environment_bindings_count { 0 };
     size_t m_lex_environment_bindings_count { 0 };
 
+    // The number of named properties the last object constructed by this function ended up with.
+    // Used to pre-size the property storage of the next `this` object.
+    mutable u32 m_expected_property_count { 0 };
+
     Variant<PropertyKey, PrivateName, Empty> m_class_field_initializer_name; // [[ClassFieldInitializerName]]
     ConstructorKind m_constructor_kind : 1 { ConstructorKind::Base };        // [[ConstructorKind]]
     bool m_is_class_constructor : 1 { false };                               // [[IsClassConstructor]]
@@ -6,6 +6,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/QuickSort.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -114,6 +118,202 @@ static ThrowCompletionOr<TypedArrayBase*> typed_array_species_create(VM& vm, Typ
     return result;
 }
 
+// Invokes the callback with the given typed array cast to its concrete TypedArray<T> type.
+template<typename Callback>
+static decltype(auto) visit_typed_array(TypedArrayBase& typed_array, Callback&& callback)
+{
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        return callback(static_cast<ClassName&>(typed_array));
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+    VERIFY_NOT_REACHED();
+}
+
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+// Finds an element with the exact bit pattern of the needle, comparing a whole vector of elements at a time.
+template<SearchDirection direction, typename T>
+static Optional<size_t> find_element_with_bit_pattern(ReadonlySpan<T> elements, T needle)
+{
+    using UnsignedType = Conditional<sizeof(T) == 1, u8, Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>>;
+    using VectorType = Conditional<sizeof(T) == 1, SIMD::u8x16, Conditional<sizeof(T) == 2, SIMD::u16x8, Conditional<sizeof(T) == 4, SIMD::u32x4, SIMD::u64x2>>>;
+    static constexpr size_t lanes = SIMD::vector_length<VectorType>;
+
+    auto const* data = reinterpret_cast<UnsignedType const*>(elements.data());
+    auto size = elements.size();
+    auto pattern = bit_cast<UnsignedType>(needle);
+
+    VectorType needle_vector {};
+    needle_vector += pattern;
+
+    auto has_match = [&](size_t offset) {
+        auto mask = SIMD::load_unaligned<VectorType>(data + offset) == needle_vector;
+        auto words = bit_cast<SIMD::u64x2>(mask);
+        return (words[0] | words[1]) != 0;
+    };
+
+    if constexpr (direction == SearchDirection::Forward) {
+        size_t offset = 0;
+        for (; offset + lanes <= size; offset += lanes) {
+            if (!has_match(offset))
+                continue;
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                if (data[offset + lane] == pattern)
+                    return offset + lane;
+            }
+        }
+        for (; offset < size; ++offset) {
+            if (data[offset] == pattern)
+                return offset;
+        }
+    } else {
+        auto end = size;
+        for (; end >= lanes; end -= lanes) {
+            if (!has_match(end - lanes))
+                continue;
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                if (data[end - lane - 1] == pattern)
+                    return end - lane - 1;
+            }
+        }
+        for (; end > 0; --end) {
+            if (data[end - 1] == pattern)
+                return end - 1;
+        }
+    }
+
+    return {};
+}
+
+enum class NaNIsEqualToNaN {
+    No,
+    Yes,
+};
+
+// Finds an element that is IsStrictlyEqual (or SameValueZero, if NaN is considered equal to NaN) to the given Number,
+// operating directly on the elements of the typed array.
+template<SearchDirection direction, typename T>
+static Optional<size_t> find_number_in_elements(ReadonlySpan<T> elements, double number, NaNIsEqualToNaN nan_is_equal_to_nan)
+{
+    auto find_if = [&](auto predicate) -> Optional<size_t> {
+        for (size_t i = 0; i < elements.size(); ++i) {
+            auto index = direction == SearchDirection::Forward ? i : elements.size() - i - 1;
+            if (predicate(elements[index]))
+                return index;
+        }
+        return {};
+    };
+
+    if constexpr (IsIntegral<T>) {
+        // Only integral Numbers within the range of T can ever be equal to one of its elements.
+        if (!Value { number }.is_integral_number())
+            return {};
+        if (number < static_cast<double>(NumericLimits<T>::min()) || number > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+
+        return find_element_with_bit_pattern<direction>(elements, static_cast<T>(number));
+    } else {
+        if (isnan(number)) {
+            if (nan_is_equal_to_nan == NaNIsEqualToNaN::No)
+                return {};
+            // NaN is the only value that is not equal to itself.
+            return find_if([](T element) { return element != element; });
+        }
+
+        // A Number that is not exactly representable as T can never be equal to one of its elements.
+        auto needle = static_cast<T>(number);
+        if (static_cast<double>(needle) != number)
+            return {};
+
+        // +0 and -0 are equal, but have different bit patterns.
+        if (needle == 0)
+            return find_if([](T element) { return element == 0; });
+
+        return find_element_with_bit_pattern<direction>(elements, needle);
+    }
+}
+
+static bool can_use_fast_typed_array_search(TypedArrayBase const& typed_array, Value search_element)
+{
+    return typed_array.content_type() == TypedArrayBase::ContentType::Number && search_element.is_number();
+}
+
+// OPTIMIZATION: Searches for a Number directly in the elements of a typed array with Number content, without going
+//               through the generic property access. Elements are only considered up to the array's current length,
+//               as the buffer may have been shrunk or detached while converting the fromIndex argument.
+static Optional<size_t> fast_typed_array_search(TypedArrayBase& typed_array, Value search_element, size_t start, size_t end, SearchDirection direction, NaNIsEqualToNaN nan_is_equal_to_nan)
+{
+    VERIFY(can_use_fast_typed_array_search(typed_array, search_element));
+    auto number = search_element.as_double();
+
+    return visit_typed_array(typed_array, [&](auto const& concrete_typed_array) -> Optional<size_t> {
+        auto elements = concrete_typed_array.data();
+
+        end = min(end, elements.size());
+        if (start >= end)
+            return {};
+
+        auto range = elements.slice(start, end - start);
+
+        Optional<size_t> index;
+        if (direction == SearchDirection::Forward)
+            index = find_number_in_elements<SearchDirection::Forward>(range, number, nan_is_equal_to_nan);
+        else
+            index = find_number_in_elements<SearchDirection::Backward>(range, number, nan_is_equal_to_nan);
+
+        if (!index.has_value())
+            return {};
+        return start + *index;
+    });
+}
+
+// OPTIMIZATION: Sorts the elements directly in the underlying buffer, in the order CompareTypedArrayElements defines when
+//               no comparefn is given. Elements that compare equal are bitwise identical (except for NaN payloads, which
+//               are not observable), so the sort does not need to be stable.
+static void sort_typed_array_with_default_comparator(TypedArrayBase& typed_array)
+{
+    visit_typed_array(typed_array, [](auto& concrete_typed_array) {
+        auto elements = concrete_typed_array.data();
+        using T = RemoveCVReference<decltype(elements[0])>;
+
+        if constexpr (sizeof(T) == 1) {
+            // There are only 256 possible values, so simply count how often each of them occurs.
+            AK::Array<size_t, 256> counts {};
+            for (auto element : elements)
+                ++counts[static_cast<u8>(element)];
+
+            size_t index = 0;
+            for (int value = NumericLimits<T>::min(); value <= NumericLimits<T>::max(); ++value) {
+                auto count = counts[static_cast<u8>(value)];
+                elements.slice(index, count).fill(static_cast<T>(value));
+                index += count;
+            }
+            return;
+        }
+
+        quick_sort(elements.begin(), elements.end(), [](T a, T b) {
+            if constexpr (!IsIntegral<T>) {
+                // NaN is sorted after all other values.
+                if (b != b)
+                    return a == a;
+                if (a != a)
+                    return false;
+
+                // -0 is sorted before +0.
+                if (a == 0 && b == 0)
+                    return signbit(static_cast<double>(a)) && !signbit(static_cast<double>(b));
+            }
+            return a < b;
+        });
+    });
+}
+
 // 23.2.3.1 %TypedArray%.prototype.at ( index ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::at)
 {
@@ -475,34 +675,6 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
-template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
-{
-    Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
-    computed_begin += typed_array.byte_offset();
-
-    Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
-    computed_end += typed_array.byte_offset();
-
-    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
-        return;
-    }
-
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
-        return;
-    }
-
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
-}
-
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
 {
@@ -571,51 +743,22 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
-        switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
-        }
-    }
-
     // 18. Repeat, while k < final,
-    while (k < final) {
-        // a. Let Pk be ! ToString(𝔽(k)).
-        // b. Perform ! Set(O, Pk, value, true).
-        CanonicalIndex canonical_index { CanonicalIndex::Type::Index, k };
-        switch (typed_array->kind()) {
-#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
-    case TypedArrayBase::Kind::ClassName:                                           \
-        (void)typed_array_set_element<Type>(*typed_array, canonical_index, value);  \
-        break;
-            JS_ENUMERATE_TYPED_ARRAYS
-#undef __JS_ENUMERATE
-        }
-
-        // c. Set k to k + 1.
-        ++k;
+    //     a. Let Pk be ! ToString(𝔽(k)).
+    //     b. Perform ! Set(O, Pk, value, true).
+    //     c. Set k to k + 1.
+    // OPTIMIZATION: Convert the value to the element type once by storing it into the first element, and then copy that
+    //               element into the rest of the range directly in the underlying buffer.
+    if (k < final) {
+        visit_typed_array(*typed_array, [&](auto& concrete_typed_array) {
+            auto elements = concrete_typed_array.data();
+            VERIFY(final <= elements.size());
+
+            auto byte_index = typed_array->byte_offset() + (static_cast<size_t>(k) * typed_array->element_size());
+            typed_array->set_value_in_buffer(byte_index, value, ArrayBuffer::Order::Unordered);
+
+            elements.slice(k + 1, final - k - 1).fill(elements[k]);
+        });
     }
 
     // 19. Return O.
@@ -923,6 +1066,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    if (can_use_fast_typed_array_search(*typed_array, search_element))
+        return Value { fast_typed_array_search(*typed_array, search_element, k, length, SearchDirection::Forward, NaNIsEqualToNaN::Yes).has_value() };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -992,6 +1138,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    if (can_use_fast_typed_array_search(*typed_array, search_element)) {
+        auto index = fast_typed_array_search(*typed_array, search_element, k, length, SearchDirection::Forward, NaNIsEqualToNaN::No);
+        return index.has_value() ? Value { *index } : Value { -1 };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1129,6 +1280,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
         k = relative_k;
     }
 
+    if (can_use_fast_typed_array_search(*typed_array, search_element)) {
+        if (k < 0)
+            return Value { -1 };
+        auto index = fast_typed_array_search(*typed_array, search_element, 0, static_cast<size_t>(k) + 1, SearchDirection::Backward, NaNIsEqualToNaN::No);
+        return index.has_value() ? Value { *index } : Value { -1 };
+    }
+
     // 9. Repeat, while k ≥ 0,
     while (k >= 0) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1361,30 +1519,22 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
 
     // 5. Let lower be 0.
     // 6. Repeat, while lower ≠ middle,
-    for (u32 lower = 0; lower != middle; ++lower) {
-        // a. Let upper be len - lower - 1.
-        auto upper = length - lower - 1;
-
-        // b. Let upperP be ! ToString(𝔽(upper)).
-        PropertyKey upper_property_key { upper };
-
-        // c. Let lowerP be ! ToString(𝔽(lower)).
-        PropertyKey lower_property_key { lower };
-
-        // d. Let lowerValue be ! Get(O, lowerP).
-        auto lower_value = MUST(typed_array->get(lower_property_key));
-
-        // e. Let upperValue be ! Get(O, upperP).
-        auto upper_value = MUST(typed_array->get(upper_property_key));
-
-        // f. Perform ! Set(O, lowerP, upperValue, true).
-        MUST(typed_array->set(lower_property_key, upper_value, Object::ShouldThrowExceptions::Yes));
-
-        // g. Perform ! Set(O, upperP, lowerValue, true).
-        MUST(typed_array->set(upper_property_key, lower_value, Object::ShouldThrowExceptions::Yes));
-
-        // h. Set lower to lower + 1.
-    }
+    //     a. Let upper be len - lower - 1.
+    //     b. Let upperP be ! ToString(𝔽(upper)).
+    //     c. Let lowerP be ! ToString(𝔽(lower)).
+    //     d. Let lowerValue be ! Get(O, lowerP).
+    //     e. Let upperValue be ! Get(O, upperP).
+    //     f. Perform ! Set(O, lowerP, upperValue, true).
+    //     g. Perform ! Set(O, upperP, lowerValue, true).
+    //     h. Set lower to lower + 1.
+    // OPTIMIZATION: Swap the elements directly in the underlying buffer, which is indistinguishable from the steps above.
+    visit_typed_array(*typed_array, [&](auto& concrete_typed_array) {
+        auto elements = concrete_typed_array.data();
+        VERIFY(elements.size() == length);
+
+        for (u32 lower = 0; lower != middle; ++lower)
+            swap(elements[lower], elements[length - lower - 1]);
+    });
 
     // 7. Return O.
     return typed_array;
@@ -1736,6 +1886,14 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::slice)
                 return array;
             }
 
+            // OPTIMIZATION: Copy all bytes at once, unless a species constructor created A on top of O's buffer such that
+            //               the copy below would read bytes it has already written.
+            auto byte_count = limit.value() - target_byte_index;
+            if (&source_buffer != &target_buffer || target_byte_index <= source_byte_index.value() || target_byte_index >= source_byte_index.value() + byte_count) {
+                target_buffer.buffer().overwrite(target_byte_index, source_buffer.buffer().data() + source_byte_index.value(), byte_count);
+                return array;
+            }
+
             // ix. Repeat, while targetByteIndex < limit,
             while (target_byte_index < limit) {
                 // 1. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, uint8, true, unordered).
@@ -1838,6 +1996,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    if (compare_function.is_undefined()) {
+        sort_typed_array_with_default_comparator(*typed_array);
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2076,6 +2239,15 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    if (compare_function.is_undefined()) {
+        visit_typed_array(*array, [&](auto& concrete_array) {
+            auto source = static_cast<decltype(concrete_array)>(*typed_array).data();
+            source.copy_to(concrete_array.data());
+        });
+        sort_typed_array_with_default_comparator(*array);
+        return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
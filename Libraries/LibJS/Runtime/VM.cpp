@@ -28,6 +28,8 @@
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
+#include <LibJS/Runtime/PromiseJobs.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
@@ -105,6 +107,10 @@ VM::VM(ErrorMessages error_messages)
         enqueue_promise_job(job, realm);
     };
 
+    host_enqueue_promise_reaction_job = [this](PromiseReaction& reaction, Value argument) {
+        enqueue_promise_reaction_job(reaction, argument);
+    };
+
     host_make_job_callback = [](FunctionObject& function_object) {
         return make_job_callback(function_object);
     };
@@ -286,8 +292,15 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
-    for (auto& job : m_promise_jobs)
-        roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    for (size_t i = m_next_promise_job_index; i < m_promise_jobs.size(); ++i) {
+        auto const& record = m_promise_jobs[i];
+        if (record.job)
+            roots.set(record.job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        if (record.reaction)
+            roots.set(record.reaction, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        if (record.argument.is_cell())
+            roots.set(&record.argument.as_cell(), GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    }
 }
 
 // 9.1.2.1 GetIdentifierReference ( env, name, strict ), https://tc39.es/ecma262/#sec-getidentifierreference
@@ -430,12 +443,27 @@ void VM::run_queued_promise_jobs_impl()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
-        dbgln_if(PROMISE_DEBUG, "Calling promise job function");
+    // NOTE: Jobs may enqueue more jobs, and may re-enter this function, so the record is copied out of the queue
+    //       before it runs.
+    while (m_next_promise_job_index < m_promise_jobs.size()) {
+        auto record = m_promise_jobs[m_next_promise_job_index++];
 
-        [[maybe_unused]] auto result = job->function()();
+        if (m_next_promise_job_index >= 1024 && m_next_promise_job_index * 2 >= m_promise_jobs.size()) {
+            m_promise_jobs.remove(0, m_next_promise_job_index);
+            m_next_promise_job_index = 0;
+        }
+
+        if (record.reaction) {
+            dbgln_if(PROMISE_DEBUG, "Running promise reaction job");
+            [[maybe_unused]] auto result = run_promise_reaction_job(*this, *record.reaction, record.argument);
+        } else {
+            dbgln_if(PROMISE_DEBUG, "Calling promise job function");
+            [[maybe_unused]] auto result = record.job->function()();
+        }
     }
+
+    m_promise_jobs.clear_with_capacity();
+    m_next_promise_job_index = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
@@ -446,7 +474,14 @@ void VM::enqueue_promise_job(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> j
     // - FIXME: Let scriptOrModule be GetActiveScriptOrModule() at the time HostEnqueuePromiseJob is invoked. If realm is not null, each time job is invoked the implementation must perform implementation-defined steps
     //          such that scriptOrModule is the active script or module at the time of job's invocation.
     // - Jobs must run in the same order as the HostEnqueuePromiseJob invocations that scheduled them.
-    m_promise_jobs.append(job);
+    m_promise_jobs.append({ .job = job, .reaction = nullptr, .argument = {} });
+}
+
+// NewPromiseReactionJob ( reaction, argument ) followed by HostEnqueuePromiseJob ( job, realm ), without allocating the job closure.
+void VM::enqueue_promise_reaction_job(PromiseReaction& reaction, Value argument)
+{
+    // NOTE: The job's realm is not needed here, as we don't do anything with it in enqueue_promise_job() either.
+    m_promise_jobs.append({ .job = nullptr, .reaction = reaction, .argument = argument });
 }
 
 void VM::run_queued_finalization_registry_cleanup_jobs()
@@ -579,6 +614,7 @@ ThrowCompletionOr<void> VM::link_and_eval_module(CyclicModule& module)
 
     run_queued_promise_jobs();
     VERIFY(m_promise_jobs.is_empty());
+    VERIFY(m_next_promise_job_index == 0);
 
     // FIXME: This will break if we start doing promises actually asynchronously.
     VERIFY(evaluated_value->state() != Promise::State::Pending);
@@ -242,12 +242,13 @@ public:
 
     void run_queued_promise_jobs()
     {
-        if (m_promise_jobs.is_empty())
+        if (m_next_promise_job_index == m_promise_jobs.size())
             return;
         run_queued_promise_jobs_impl();
     }
 
     void enqueue_promise_job(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>> job, Realm*);
+    void enqueue_promise_reaction_job(PromiseReaction&, Value argument);
 
     void run_queued_finalization_registry_cleanup_jobs();
     void enqueue_finalization_registry_cleanup_job(FinalizationRegistry&);
@@ -285,6 +286,8 @@ public:
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
     Function<void(GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>, Realm*)> host_enqueue_promise_job;
+    // NOTE: This is NewPromiseReactionJob followed by HostEnqueuePromiseJob, letting the host skip allocating a closure for the job.
+    Function<void(PromiseReaction&, Value)> host_enqueue_promise_reaction_job;
     Function<GC::Ref<JobCallback>(FunctionObject&)> host_make_job_callback;
     Function<GC::Ptr<PrimitiveString>(Object const&)> host_get_code_for_eval;
     Function<ThrowCompletionOr<void>(Realm&, ReadonlySpan<String>, StringView, StringView, CompilationType, ReadonlySpan<Value>, Value)> host_ensure_can_compile_strings;
@@ -332,7 +335,17 @@ private:
     // GlobalSymbolRegistry, https://tc39.es/ecma262/#table-globalsymbolregistry-record-fields
     HashMap<Utf16String, GC::Ref<Symbol>> m_global_symbol_registry;
 
-    Vector<GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>> m_promise_jobs;
+    // A queued promise job is either an arbitrary job closure, or a promise reaction together with its argument.
+    struct PromiseJobRecord {
+        GC::Ptr<GC::Function<ThrowCompletionOr<Value>()>> job;
+        GC::Ptr<PromiseReaction> reaction;
+        Value argument;
+    };
+
+    // NOTE: Jobs are consumed from the front by advancing m_next_promise_job_index, and the already consumed
+    //       prefix is only dropped once it makes up a large part of the queue, so enqueuing and dequeuing are O(1).
+    Vector<PromiseJobRecord> m_promise_jobs;
+    size_t m_next_promise_job_index { 0 };
 
     Vector<GC::Ptr<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
@@ -31,8 +31,9 @@ void WeakMap::remove_dead_cells(Badge<GC::Heap>)
 void WeakMap::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    // NOTE: Each value is only reachable through the map for as long as its key is reachable from elsewhere.
     for (auto& entry : m_values)
-        visitor.visit(entry.value);
+        visitor.visit_ephemeron(*entry.key, entry.value);
 }
 
 }
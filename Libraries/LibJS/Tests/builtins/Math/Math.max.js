@@ -10,3 +10,29 @@ test("basic functionality", () => {
     expect(Math.max(NaN)).toBeNaN();
     expect(Math.max("String", 1)).toBeNaN();
 });
+
+test("two arguments", () => {
+    expect(Math.max(-5, 7)).toBe(7);
+    expect(Math.max(2147483647, -2147483648)).toBe(2147483647);
+    expect(Math.max(1.5, 1)).toBe(1.5);
+    expect(Math.max(1, NaN)).toBeNaN();
+    expect(Math.max(-0, -0)).toBe(-0);
+    expect(Math.max("3", 2)).toBe(3);
+
+    const order = [];
+    const a = { valueOf: () => (order.push("a"), NaN) };
+    const b = { valueOf: () => (order.push("b"), 1) };
+    expect(Math.max(a, b)).toBeNaN();
+    expect(order).toEqual(["a", "b"]);
+});
+
+test("redefined Math.max is called", () => {
+    const originalMax = Math.max;
+    try {
+        Math.max = (a, b) => "redefined";
+        expect(Math.max(1, 2)).toBe("redefined");
+    } finally {
+        Math.max = originalMax;
+    }
+    expect(Math.max(1, 2)).toBe(2);
+});
@@ -9,3 +9,12 @@ test("basic functionality", () => {
     expect(Math.min(NaN)).toBeNaN();
     expect(Math.min("String", 1)).toBeNaN();
 });
+
+test("two arguments", () => {
+    expect(Math.min(-5, 7)).toBe(-5);
+    expect(Math.min(2147483647, -2147483648)).toBe(-2147483648);
+    expect(Math.min(1.5, 2)).toBe(1.5);
+    expect(Math.min(NaN, 1)).toBeNaN();
+    expect(Math.min(0, -0)).toBe(-0);
+    expect(Math.min("3", 4)).toBe(3);
+});
@@ -10,3 +10,17 @@ test("basic functionality", () => {
     expect(Math.trunc("foo")).toBeNaN();
     expect(Math.trunc()).toBeNaN();
 });
+
+test("integral and int32 arguments", () => {
+    expect(Math.trunc(42)).toBe(42);
+    expect(Math.trunc(-2147483648)).toBe(-2147483648);
+    expect(Math.trunc(-0)).toBe(-0);
+    expect(Math.trunc(1e21 + 0.5)).toBe(1e21);
+    expect(Math.floor(-7)).toBe(-7);
+    expect(Math.ceil(-7)).toBe(-7);
+    expect(Math.round(-7)).toBe(-7);
+    expect(Math.sign(-7)).toBe(-1);
+    expect(Math.sign(0)).toBe(0);
+    expect(Math.clz32(-1)).toBe(0);
+    expect(Math.clz32(1)).toBe(31);
+});
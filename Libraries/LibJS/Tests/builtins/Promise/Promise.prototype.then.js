@@ -168,3 +168,55 @@ describe("normal behavior", () => {
         runQueuedPromiseJobs();
     });
 });
+
+describe("reaction job ordering", () => {
+    test("reactions on settled and pending promises run in enqueue order", () => {
+        const order = [];
+        let resolvePending;
+        const pending = new Promise(resolve => {
+            resolvePending = resolve;
+        });
+        const fulfilled = Promise.resolve("fulfilled");
+        const rejected = Promise.reject("rejected");
+
+        pending.then(value => order.push(value));
+        fulfilled.then(value => order.push(value));
+        rejected.then(
+            () => order.push("unreachable"),
+            reason => order.push(reason)
+        );
+        resolvePending("pending");
+        fulfilled.then(value => order.push(`${value} again`));
+
+        expect(order).toEqual([]);
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["fulfilled", "rejected", "pending", "fulfilled again"]);
+    });
+
+    test("reactions queued by reactions run after already queued ones", () => {
+        const order = [];
+        Promise.resolve()
+            .then(() => order.push("a1"))
+            .then(() => order.push("a2"));
+        Promise.resolve()
+            .then(() => order.push("b1"))
+            .then(() => order.push("b2"));
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["a1", "b1", "a2", "b2"]);
+    });
+
+    test("many chained awaits", () => {
+        let count = 0;
+        let done = false;
+        (async () => {
+            for (let i = 0; i < 5000; ++i) {
+                await i;
+                ++count;
+            }
+            done = true;
+        })();
+        runQueuedPromiseJobs();
+        expect(count).toBe(5000);
+        expect(done).toBeTrue();
+    });
+});
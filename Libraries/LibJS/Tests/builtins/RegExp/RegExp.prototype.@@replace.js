@@ -25,3 +25,97 @@ describe("basic functionality", () => {
         expect(accessedUnicode).toBeFalse();
     });
 });
+
+describe("builtin exec results", () => {
+    test("captures are only used when referenced", () => {
+        expect("a1b2c3".replace(/([a-z])(\d)/g, "-")).toBe("---");
+        expect("a1b2c3".replace(/([a-z])(\d)/g, "$2$1")).toBe("1a2b3c");
+        expect("a1b2".replace(/([a-z])(x)?(\d)/g, "[$1|$2|$3]")).toBe("[a||1][b||2]");
+        expect("a1b2".replace(/([a-z])(x)?(\d)/g, (match, letter, x, digit, position, string) => {
+            expect(x).toBeUndefined();
+            expect(string).toBe("a1b2");
+            return `${digit}${letter}@${position}`;
+        })).toBe("1a@02b@2");
+    });
+
+    test("named groups", () => {
+        expect("2020-01".replace(/(?<year>\d+)-(?<month>\d+)/, "$<month>/$<year>")).toBe("01/2020");
+        expect("2020-01".replace(/(?<year>\d+)-(?<month>\d+)/, (...args) => args.at(-1).month)).toBe("01");
+    });
+
+    test("empty matches advance by code point in unicode mode", () => {
+        expect("a😀b".replace(/(?:)/gu, "-")).toBe("-a-😀-b-");
+        expect("a😀b".replace(/(?:)/g, "-")).toBe("-a-\ud83d-\ude00-b-");
+    });
+
+    test("overridden exec is still called", () => {
+        const re = /a/g;
+        let calls = 0;
+        re.exec = function (string) {
+            ++calls;
+            return RegExp.prototype.exec.call(this, string);
+        };
+        expect("aXa".replace(re, "b")).toBe("bXb");
+        expect(calls).toBe(3);
+    });
+
+    test("own exec deleted mid-replace falls back to the builtin", () => {
+        const re = /a/g;
+        const originalExec = RegExp.prototype.exec;
+        let calls = 0;
+        re.exec = function (string) {
+            ++calls;
+            delete re.exec;
+            return originalExec.call(this, string);
+        };
+        expect("aaa".replace(re, "b")).toBe("bbb");
+        expect(calls).toBe(1);
+    });
+
+    test("exec replaced on the prototype is called", () => {
+        const originalExec = RegExp.prototype.exec;
+        try {
+            let calls = 0;
+            RegExp.prototype.exec = function (string) {
+                ++calls;
+                return originalExec.call(this, string);
+            };
+            expect("aXa".replace(/a/g, "b")).toBe("bXb");
+            expect(calls).toBe(3);
+
+            RegExp.prototype.exec = () => null;
+            expect("aXa".replace(/a/g, "b")).toBe("aXa");
+        } finally {
+            RegExp.prototype.exec = originalExec;
+        }
+        expect("aXa".replace(/a/g, "b")).toBe("bXb");
+    });
+
+    test("exec replaced on the prototype mid-replace", () => {
+        const originalExec = RegExp.prototype.exec;
+        try {
+            let calls = 0;
+            RegExp.prototype.exec = function (string) {
+                ++calls;
+                RegExp.prototype.exec = originalExec;
+                return originalExec.call(this, string);
+            };
+            expect("aaa".replace(/a/g, "b")).toBe("bbb");
+            expect(calls).toBe(1);
+
+            RegExp.prototype.exec = function (string) {
+                ++calls;
+                return null;
+            };
+            const re = /a/g;
+            re.exec = function (string) {
+                delete re.exec;
+                return originalExec.call(this, string);
+            };
+            expect("aaa".replace(re, "b")).toBe("baa");
+            expect(calls).toBe(2);
+        } finally {
+            RegExp.prototype.exec = originalExec;
+        }
+    });
+});
@@ -328,3 +328,24 @@ test("invalid named group references", () => {
         new RegExp("(?<a>x)\\k<nonexistent>");
     }).toThrow();
 });
+
+test("plain string patterns", () => {
+    let re = /needle/g;
+    let haystack = "hay".repeat(100) + "needle" + "hay".repeat(100) + "needle";
+
+    let result = re.exec(haystack);
+    expect(result.index).toBe(300);
+    expect(re.lastIndex).toBe(306);
+
+    result = re.exec(haystack);
+    expect(result.index).toBe(606);
+    expect(re.lastIndex).toBe(612);
+
+    expect(re.exec(haystack)).toBeNull();
+    expect(re.lastIndex).toBe(0);
+
+    expect(/needle/y.exec(haystack)).toBeNull();
+    expect(/NEEDLE/i.exec(haystack).index).toBe(300);
+    expect(/😀/.exec("a😀").index).toBe(1);
+    expect(/\ude00/.exec("a😀").index).toBe(2);
+});
@@ -103,3 +103,27 @@ test("property escapes", () => {
     expect(/\p{Any}/u.test("\u0378")).toBeTrue();
     expect(/\p{Assigned}/u.test("\u0378")).toBeFalse();
 });
+
+test("updates lastIndex and legacy static properties like exec", () => {
+    const re = /(b)(c)?/g;
+    expect(re.test("abcab")).toBeTrue();
+    expect(re.lastIndex).toBe(3);
+    expect(RegExp.$1).toBe("b");
+    expect(RegExp.$2).toBe("c");
+    expect(RegExp.lastMatch).toBe("bc");
+    expect(re.test("abcab")).toBeTrue();
+    expect(re.lastIndex).toBe(5);
+    expect(RegExp.$2).toBe("");
+    expect(re.test("abcab")).toBeFalse();
+    expect(re.lastIndex).toBe(0);
+});
+
+test("split and search with captures", () => {
+    expect("a1b22c".split(/(\d)+/)).toEqual(["a", "1", "b", "2", "c"]);
+    expect("a1b22c".split(/(x)?\d+/)).toEqual(["a", undefined, "b", undefined, "c"]);
+    expect("a1b22c".split(/\d+/, 2)).toEqual(["a", "b"]);
+    expect("".split(/x/)).toEqual([""]);
+    expect("a1b22c".search(/\d\d/)).toBe(3);
+    expect("a1b22c".search(/x/)).toBe(-1);
+    expect("a1b22c".match(/\d+/g)).toEqual(["1", "22"]);
+});
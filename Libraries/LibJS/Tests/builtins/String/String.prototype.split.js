@@ -18,6 +18,21 @@ test("limits", () => {
     expect("a b c d".split(" ", 1)).toEqual(["a"]);
     expect("a b c d".split(" ", 3)).toEqual(["a", "b", "c"]);
     expect("a b c d".split(" ", 100)).toEqual(["a", "b", "c", "d"]);
+    expect("abcd".split("", 2)).toEqual(["a", "b"]);
+});
+
+test("long strings", () => {
+    const line = "[info] request handled in 12ms";
+    const log = Array(1000).fill(line).join("\n");
+    expect(log.split("\n")).toHaveLength(1000);
+    expect(log.split("\n").every(entry => entry === line)).toBeTrue();
+    expect(log.split("handled in").length).toBe(1001);
+});
+
+test("UTF-16", () => {
+    expect("😀a😀b".split("😀")).toEqual(["", "a", "b"]);
+    expect("😀".split("")).toEqual(["\ud83d", "\ude00"]);
+    expect("😀".split("\ude00")).toEqual(["\ud83d", ""]);
 });
 
 test("regex split", () => {
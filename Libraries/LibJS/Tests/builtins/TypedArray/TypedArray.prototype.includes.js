@@ -63,3 +63,49 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        typedArray[997] = 42;
+
+        expect(typedArray.includes(42)).toBeTrue();
+        expect(typedArray.includes(42, 998)).toBeFalse();
+        expect(typedArray.includes(42.5)).toBeFalse();
+        expect(typedArray.includes("42")).toBeFalse();
+    });
+});
+
+test("NaN and signed zero", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([1, NaN, -0]);
+        expect(typedArray.includes(NaN)).toBeTrue();
+        expect(typedArray.includes(0)).toBeTrue();
+        expect(typedArray.includes(-0)).toBeTrue();
+    });
+});
+
+test("buffer shrunk while converting fromIndex", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const arrayBuffer = new ArrayBuffer(T.BYTES_PER_ELEMENT * 4, { maxByteLength: T.BYTES_PER_ELEMENT * 4 });
+        const typedArray = new T(arrayBuffer);
+        typedArray.fill(1);
+
+        const fromIndex = {
+            valueOf() {
+                arrayBuffer.resize(T.BYTES_PER_ELEMENT);
+                return 1;
+            },
+        };
+        expect(typedArray.includes(1, fromIndex)).toBeFalse();
+
+        arrayBuffer.resize(T.BYTES_PER_ELEMENT * 4);
+        const shrinkingFromIndex = {
+            valueOf() {
+                arrayBuffer.resize(T.BYTES_PER_ELEMENT);
+                return 1;
+            },
+        };
+        expect(typedArray.includes(undefined, shrinkingFromIndex)).toBeTrue();
+    });
+});
@@ -63,3 +63,23 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        typedArray[3] = 42;
+        typedArray[997] = 42;
+
+        expect(typedArray.indexOf(42)).toBe(3);
+        expect(typedArray.indexOf(42, 4)).toBe(997);
+        expect(typedArray.indexOf(42, 998)).toBe(-1);
+        expect(typedArray.indexOf(43)).toBe(-1);
+    });
+
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([1, NaN, -0]);
+        expect(typedArray.indexOf(NaN)).toBe(-1);
+        expect(typedArray.indexOf(0)).toBe(2);
+        expect(typedArray.indexOf(0.1)).toBe(-1);
+    });
+});
@@ -63,3 +63,17 @@ test("basic functionality", () => {
         expect(typedArray.lastIndexOf(2n, -2)).toBe(1);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        typedArray[3] = 42;
+        typedArray[997] = 42;
+
+        expect(typedArray.lastIndexOf(42)).toBe(997);
+        expect(typedArray.lastIndexOf(42, 996)).toBe(3);
+        expect(typedArray.lastIndexOf(42, 2)).toBe(-1);
+        expect(typedArray.lastIndexOf(42, -1)).toBe(997);
+        expect(typedArray.lastIndexOf(43)).toBe(-1);
+    });
+});
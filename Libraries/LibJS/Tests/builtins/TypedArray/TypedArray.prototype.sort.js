@@ -90,3 +90,25 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("default comparator", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(300);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = (i * 37) % 101;
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+
+    expect(new Int8Array([5, -1, 127, -128, 0]).sort()).toEqual(new Int8Array([-128, -1, 0, 5, 127]));
+
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const sorted = new T([NaN, 1, 0, -0, -Infinity, NaN, -1]).sort();
+        expect(sorted[0]).toBe(-Infinity);
+        expect(sorted[1]).toBe(-1);
+        expect(sorted[2]).toBe(-0);
+        expect(sorted[3]).toBe(0);
+        expect(sorted[4]).toBe(1);
+        expect(sorted[5]).toBeNaN();
+        expect(sorted[6]).toBeNaN();
+    });
+});
@@ -45,3 +45,24 @@ test.xfail("automatic removal of garbage-collected values", () => {
 
     expect(getWeakMapSize(weakMap)).toBe(0);
 });
+
+test("values referencing their own key do not keep the entry alive", () => {
+    const weakMap = new WeakMap();
+
+    // NOTE: The entries are created in a separate function, so that no stale references to their keys are left in
+    //       this function's registers for the conservative stack scan to find.
+    function addEntriesWithValuesReferencingTheirKey() {
+        for (let i = 0; i < 1000; ++i) {
+            const key = {};
+            weakMap.set(key, { key });
+        }
+    }
+    addEntriesWithValuesReferencingTheirKey();
+    expect(getWeakMapSize(weakMap)).toBe(1000);
+
+    gc();
+
+    // A few keys may still be found by the conservative stack scan, but without ephemeron semantics all of the
+    // entries would be kept alive by their own values.
+    expect(getWeakMapSize(weakMap)).toBeLessThan(10);
+});
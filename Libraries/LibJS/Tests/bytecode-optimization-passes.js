@@ -0,0 +1,90 @@
+test("branches on constant conditions", () => {
+    const taken = [];
+    if (1) taken.push("if-1");
+    if ("") taken.push("if-empty-string");
+    if (null ?? "fallback") taken.push("nullish");
+    while (0) taken.push("while-0");
+    do {
+        taken.push("do-once");
+    } while (false);
+    for (; undefined; ) taken.push("for-undefined");
+    expect(taken).toEqual(["if-1", "nullish", "do-once"]);
+
+    const x = 0 ? "a" : "b";
+    expect(x).toBe("b");
+    expect(undefined?.foo).toBeUndefined();
+    expect(null ?? 42).toBe(42);
+});
+
+test("constants forwarded through temporaries keep their values", () => {
+    function f(flag) {
+        let value = 1;
+        if (flag) value = 2;
+        else value = 3;
+        let other = value;
+        value = 4;
+        return [other, value];
+    }
+    expect(f(true)).toEqual([2, 4]);
+    expect(f(false)).toEqual([3, 4]);
+});
+
+test("chains of jumps through nested loops and labels", () => {
+    const visited = [];
+    outer: for (let i = 0; i < 3; ++i) {
+        for (let j = 0; j < 3; ++j) {
+            if (j === 1) continue;
+            if (i === 1) continue outer;
+            if (i === 2 && j === 2) break outer;
+            visited.push(`${i}${j}`);
+        }
+    }
+    expect(visited).toEqual(["00", "02", "20"]);
+});
+
+test("unreachable code after return, break and throw", () => {
+    function f() {
+        try {
+            return "try";
+            // eslint-disable-next-line no-unreachable
+            expect().fail();
+        } finally {
+            // eslint-disable-next-line no-unsafe-finally
+            if (false) return "never";
+        }
+    }
+    expect(f()).toBe("try");
+
+    function g() {
+        try {
+            throw 1;
+        } catch {
+            return "catch";
+        }
+        // eslint-disable-next-line no-unreachable
+        return "after";
+    }
+    expect(g()).toBe("catch");
+});
+
+test("generators and async functions with constant conditions", () => {
+    function* gen() {
+        while (true) {
+            const value = yield 1;
+            if (value) break;
+        }
+        if (0) yield "never";
+        return 2;
+    }
+    const it = gen();
+    expect(it.next().value).toBe(1);
+    expect(it.next(false).value).toBe(1);
+    expect(it.next(true)).toEqual({ value: 2, done: true });
+
+    let result;
+    (async () => {
+        if (true) result = await "awaited";
+    })();
+    runQueuedPromiseJobs();
+    expect(result).toBe("awaited");
+});
@@ -153,3 +153,65 @@ describe("special left hand sides", () => {
         expect(vals).toEqual([1, 2]);
     });
 });
+
+describe("generators", () => {
+    test("values are produced lazily and the return value is ignored", () => {
+        const log = [];
+        function* generator() {
+            log.push("start");
+            yield 1;
+            log.push("middle");
+            yield 2;
+            return 3;
+        }
+
+        const values = [];
+        for (const value of generator()) {
+            log.push(`got ${value}`);
+            values.push(value);
+        }
+        expect(values).toEqual([1, 2]);
+        expect(log).toEqual(["start", "got 1", "middle", "got 2"]);
+    });
+
+    test("breaking out of the loop runs finally blocks", () => {
+        let cleanedUp = false;
+        function* generator() {
+            try {
+                yield 1;
+                yield 2;
+            } finally {
+                cleanedUp = true;
+            }
+        }
+
+        for (const value of generator()) {
+            expect(value).toBe(1);
+            break;
+        }
+        expect(cleanedUp).toBeTrue();
+    });
+
+    test("exceptions thrown by the generator propagate", () => {
+        function* generator() {
+            yield 1;
+            throw new Error("oops");
+        }
+
+        const values = [];
+        expect(() => {
+            for (const value of generator()) values.push(value);
+        }).toThrowWithMessage(Error, "oops");
+        expect(values).toEqual([1]);
+    });
+
+    test("many iterations", () => {
+        function* range(n) {
+            for (let i = 0; i < n; ++i) yield i;
+        }
+
+        let sum = 0;
+        for (const value of range(10000)) sum += value;
+        expect(sum).toBe(49995000);
+    });
+});
@@ -131,6 +131,104 @@ describe("correct behavior", () => {
         }
         expect(go("foo")).toEqual({ f: "foo" });
     });
+
+    test("growing and shrinking the property storage", () => {
+        const o = {};
+        for (let i = 0; i < 10; ++i) o[`p${i}`] = i;
+        expect(Object.keys(o)).toHaveLength(10);
+        for (let i = 0; i < 10; ++i) expect(o[`p${i}`]).toBe(i);
+
+        for (let i = 0; i < 10; i += 2) delete o[`p${i}`];
+        expect(Object.keys(o)).toEqual(["p1", "p3", "p5", "p7", "p9"]);
+        for (let i = 1; i < 10; i += 2) expect(o[`p${i}`]).toBe(i);
+    });
+
+    test("object literals evaluated repeatedly", () => {
+        const make = (a, b) => ({ a, b, "c d": a + b, e: [a], f: { g: b } });
+        for (let i = 0; i < 5; ++i) {
+            const o = make(i, `${i}`);
+            expect(Object.keys(o)).toEqual(["a", "b", "c d", "e", "f"]);
+            expect(o.a).toBe(i);
+            expect(o.b).toBe(`${i}`);
+            expect(o["c d"]).toBe(`${i}${i}`);
+            expect(o.e).toEqual([i]);
+            expect(o.f.g).toBe(`${i}`);
+            expect(Object.getPrototypeOf(o)).toBe(Object.prototype);
+        }
+
+        const first = make(1, 2);
+        const second = make(3, 4);
+        delete first.a;
+        first.z = 1;
+        expect(Object.keys(first)).toEqual(["b", "c d", "e", "f", "z"]);
+        expect(Object.keys(second)).toEqual(["a", "b", "c d", "e", "f"]);
+    });
+
+    test("object literal properties do not invoke setters on Object.prototype", () => {
+        let setterCalled = false;
+        Object.defineProperty(Object.prototype, "literalSetterTest", {
+            set() {
+                setterCalled = true;
+            },
+            configurable: true,
+        });
+        try {
+            for (let i = 0; i < 3; ++i) {
+                const o = { literalSetterTest: i, other: i };
+                expect(Object.getOwnPropertyDescriptor(o, "literalSetterTest")).toEqual({
+                    value: i,
+                    writable: true,
+                    enumerable: true,
+                    configurable: true,
+                });
+            }
+            expect(setterCalled).toBeFalse();
+        } finally {
+            delete Object.prototype.literalSetterTest;
+        }
+    });
+
+    test("object literal values are evaluated in order", () => {
+        let x = 1;
+        const o = { a: x, b: (x = 2), c: x };
+        expect(o).toEqual({ a: 1, b: 2, c: 2 });
+    });
+
+    test("object literals with accessors, computed keys and spreads", () => {
+        const key = "computed";
+        for (let i = 0; i < 3; ++i) {
+            const o = {
+                a: i,
+                [key]: i + 1,
+                get g() {
+                    return this.a;
+                },
+                m() {
+                    return this[key];
+                },
+                ...{ s: i + 2, t: i + 3 },
+                __proto__: null,
+                0: "indexed",
+            };
+            expect(Object.keys(o)).toEqual(["0", "a", "computed", "g", "m", "s", "t"]);
+            expect(o.g).toBe(i);
+            expect(o.m()).toBe(i + 1);
+            expect(o.s).toBe(i + 2);
+            expect(o.t).toBe(i + 3);
+            expect(Object.getPrototypeOf(o)).toBeNull();
+        }
+    });
+
+    test("constructors that add varying numbers of properties", () => {
+        function C(n) {
+            for (let i = 0; i < n; ++i) this[`p${i}`] = i;
+        }
+        for (const n of [0, 8, 2, 12, 5, 1]) {
+            const o = new C(n);
+            expect(Object.keys(o)).toHaveLength(n);
+            for (let i = 0; i < n; ++i) expect(o[`p${i}`]).toBe(i);
+        }
+    });
 });
 
 describe("side effects", () => {
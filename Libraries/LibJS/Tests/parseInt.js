@@ -57,3 +57,24 @@ test("parseInt() radix is coerced to a number", () => {
     };
     expect(parseInt("11", obj)).toBe(11);
 });
+
+test("int32 arguments", () => {
+    expect(parseInt(42, 10)).toBe(42);
+    expect(parseInt(-42)).toBe(-42);
+    expect(parseInt(-2147483648, 10)).toBe(-2147483648);
+    expect(parseInt(42, 16)).toBe(66);
+    expect(parseInt(42, 36)).toBe(146);
+    expect(Number.parseInt(17, 10)).toBe(17);
+    expect(globalThis.parseInt(17, 8)).toBe(15);
+});
+
+test("redefined parseInt is called", () => {
+    const originalParseInt = globalThis.parseInt;
+    try {
+        globalThis.parseInt = () => "redefined";
+        expect(parseInt("1", 10)).toBe("redefined");
+        expect(Number.parseInt("1", 10)).toBe(1);
+    } finally {
+        globalThis.parseInt = originalParseInt;
+    }
+});
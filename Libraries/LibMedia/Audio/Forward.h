@@ -11,6 +11,7 @@ namespace Audio {
 class ConnectionToServer;
 class Loader;
 class PlaybackStream;
+class Resampler;
 struct Sample;
 
 }
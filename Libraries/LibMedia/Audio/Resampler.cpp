@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/IntegralMath.h>
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibMedia/Audio/Resampler.h>
+
+namespace Audio {
+
+// If the reduced output rate has more phases than this, the phase of each output is rounded down to one of this many
+// phases instead. The resulting timing error is at most 1/1024th of an input sample.
+static constexpr size_t MAX_PHASE_COUNT = 1024;
+
+// When downsampling, the filter is widened to keep the transition band the same relative to the output rate. This
+// limits the cost of extreme downsampling ratios.
+static constexpr size_t MAX_TAP_COUNT = 1024;
+
+static constexpr auto VECTOR_LENGTH = SIMD::vector_length<SIMD::f32x4>;
+
+struct QualityParameters {
+    size_t tap_count;
+    double kaiser_beta;
+    // The fraction of the lower of the two Nyquist frequencies that is passed through.
+    double passband;
+};
+
+static QualityParameters parameters_for_quality(Resampler::Quality quality)
+{
+    switch (quality) {
+    case Resampler::Quality::Fast:
+        return { 16, 6.0, 0.85 };
+    case Resampler::Quality::Medium:
+        return { 32, 8.0, 0.9 };
+    case Resampler::Quality::High:
+        return { 64, 10.0, 0.94 };
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// The zeroth order modified Bessel function of the first kind, which the Kaiser window is defined with.
+static double bessel_i0(double x)
+{
+    double sum = 1;
+    double term = 1;
+    auto half_x_squared = (x / 2) * (x / 2);
+    for (int k = 1; k < 64; ++k) {
+        term *= half_x_squared / (k * k);
+        sum += term;
+        if (term < sum * 1e-17)
+            break;
+    }
+    return sum;
+}
+
+static double kaiser_window(double x, double beta)
+{
+    if (x <= -1 || x >= 1)
+        return 0;
+    return bessel_i0(beta * AK::sqrt(1 - (x * x))) / bessel_i0(beta);
+}
+
+static double sinc(double x)
+{
+    if (x == 0)
+        return 1;
+    return AK::sin(AK::Pi<double> * x) / (AK::Pi<double> * x);
+}
+
+// OPTIMIZATION: This is where nearly all of the time is spent, so the tap count is always a multiple of the vector
+//               length and the products are accumulated in vectors.
+static float dot_product(float const* samples, float const* coefficients, size_t count)
+{
+    SIMD::f32x4 sum {};
+    for (size_t i = 0; i < count; i += VECTOR_LENGTH)
+        sum += SIMD::load_unaligned<SIMD::f32x4>(&samples[i]) * SIMD::load_unaligned<SIMD::f32x4>(&coefficients[i]);
+    return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+ErrorOr<NonnullOwnPtr<Resampler>> Resampler::create(u32 input_sample_rate, u32 output_sample_rate, u8 channel_count, Quality quality)
+{
+    VERIFY(input_sample_rate != 0);
+    VERIFY(output_sample_rate != 0);
+    VERIFY(channel_count != 0);
+
+    auto divisor = gcd(input_sample_rate, output_sample_rate);
+    u64 input_step = input_sample_rate / divisor;
+    u64 output_step = output_sample_rate / divisor;
+
+    auto parameters = parameters_for_quality(quality);
+
+    // The cutoff frequency, in cycles per input sample. When downsampling, everything above the output's Nyquist
+    // frequency has to be removed to prevent aliasing.
+    auto ratio = min(1.0, static_cast<double>(output_sample_rate) / input_sample_rate);
+    auto cutoff = 0.5 * ratio * parameters.passband;
+
+    auto tap_count = static_cast<size_t>(AK::ceil(parameters.tap_count / ratio));
+    tap_count = min(align_up_to(tap_count, VECTOR_LENGTH), MAX_TAP_COUNT);
+    auto half_tap_count = tap_count / 2;
+
+    auto phase_count = static_cast<size_t>(min<u64>(output_step, MAX_PHASE_COUNT));
+    auto coefficients = TRY(FixedArray<float>::create(phase_count * tap_count));
+
+    for (size_t phase = 0; phase < phase_count; ++phase) {
+        auto fraction = static_cast<double>(phase) / phase_count;
+        auto row = coefficients.span().slice(phase * tap_count, tap_count);
+
+        // Tap j is applied to the input sample that is (fraction + half_tap_count - 1 - j) samples before the output.
+        double sum = 0;
+        for (size_t tap = 0; tap < tap_count; ++tap) {
+            auto distance = fraction + static_cast<double>(half_tap_count) - 1 - static_cast<double>(tap);
+            auto value = 2 * cutoff * sinc(2 * cutoff * distance) * kaiser_window(distance / half_tap_count, parameters.kaiser_beta);
+            row[tap] = static_cast<float>(value);
+            sum += value;
+        }
+
+        // Normalize every phase to unity gain, so that the phases don't modulate a constant signal.
+        for (auto& coefficient : row)
+            coefficient = static_cast<float>(coefficient / sum);
+    }
+
+    Vector<Vector<float>> channel_buffers;
+    TRY(channel_buffers.try_resize(channel_count));
+
+    auto resampler = TRY(adopt_nonnull_own_or_enomem(new (nothrow) Resampler(input_sample_rate, output_sample_rate, channel_count, input_step, output_step, tap_count, phase_count, move(coefficients), move(channel_buffers))));
+    resampler->reset();
+    return resampler;
+}
+
+Resampler::Resampler(u32 input_sample_rate, u32 output_sample_rate, u8 channel_count, u64 input_step, u64 output_step, size_t tap_count, size_t phase_count, FixedArray<float> coefficients, Vector<Vector<float>> channel_buffers)
+    : m_input_sample_rate(input_sample_rate)
+    , m_output_sample_rate(output_sample_rate)
+    , m_channel_count(channel_count)
+    , m_input_step(input_step)
+    , m_output_step(output_step)
+    , m_tap_count(tap_count)
+    , m_phase_count(phase_count)
+    , m_coefficients(move(coefficients))
+    , m_channel_buffers(move(channel_buffers))
+{
+}
+
+void Resampler::reset()
+{
+    // The input before the start of the stream is treated as silence.
+    auto history_size = (m_tap_count / 2) - 1;
+    for (auto& buffer : m_channel_buffers) {
+        buffer.clear_with_capacity();
+        buffer.resize(history_size);
+    }
+    m_position = history_size;
+    m_phase = 0;
+    m_input_count = 0;
+    m_output_count = 0;
+}
+
+ReadonlySpan<float> Resampler::coefficients_for_phase(u64 phase) const
+{
+    auto index = phase;
+    if (m_output_step != m_phase_count)
+        index = phase * m_phase_count / m_output_step;
+    return m_coefficients.span().slice(index * m_tap_count, m_tap_count);
+}
+
+ErrorOr<void> Resampler::process(ReadonlySpan<float> input, Vector<float>& output)
+{
+    VERIFY(input.size() % m_channel_count == 0);
+    auto frame_count = input.size() / m_channel_count;
+
+    for (size_t channel = 0; channel < m_channel_count; ++channel) {
+        auto& buffer = m_channel_buffers[channel];
+        TRY(buffer.try_ensure_capacity(buffer.size() + frame_count));
+        for (size_t frame = 0; frame < frame_count; ++frame)
+            buffer.unchecked_append(input[(frame * m_channel_count) + channel]);
+    }
+    m_input_count += frame_count;
+
+    return produce_output(output, false);
+}
+
+ErrorOr<void> Resampler::flush(Vector<float>& output)
+{
+    // Pad the input with enough silence for the filter to reach past the last input sample.
+    for (auto& buffer : m_channel_buffers)
+        TRY(buffer.try_resize(buffer.size() + (m_tap_count / 2)));
+
+    TRY(produce_output(output, true));
+    reset();
+    return {};
+}
+
+ErrorOr<void> Resampler::produce_output(Vector<float>& output, bool is_flushing)
+{
+    auto half_tap_count = m_tap_count / 2;
+    auto buffer_size = m_channel_buffers[0].size();
+
+    // Every output needs the input up to half_tap_count samples after its time.
+    if (m_position + half_tap_count >= buffer_size)
+        return {};
+    auto end = buffer_size - half_tap_count;
+
+    auto maximum_output_count = (((end - m_position) * m_output_step) / m_input_step) + 1;
+    TRY(output.try_ensure_capacity(output.size() + (maximum_output_count * m_channel_count)));
+
+    while (m_position < end) {
+        // When flushing, only the outputs whose times lie within the input are produced, the rest is padding.
+        if (is_flushing && m_output_count * m_input_step >= m_input_count * m_output_step)
+            break;
+
+        auto coefficients = coefficients_for_phase(m_phase);
+        auto first_index = m_position + 1 - half_tap_count;
+        for (auto const& buffer : m_channel_buffers)
+            output.unchecked_append(dot_product(&buffer[first_index], coefficients.data(), m_tap_count));
+        ++m_output_count;
+
+        m_phase += m_input_step;
+        m_position += m_phase / m_output_step;
+        m_phase %= m_output_step;
+    }
+
+    // Drop the input that no future output will need.
+    auto consumed_count = min(m_position + 1 - half_tap_count, buffer_size);
+    for (auto& buffer : m_channel_buffers)
+        buffer.remove(0, consumed_count);
+    m_position -= consumed_count;
+
+    return {};
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/FixedArray.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibMedia/Export.h>
+
+namespace Audio {
+
+// Converts interleaved float samples from one sample rate to another with a polyphase windowed-sinc filter.
+//
+// The resampler keeps the filter history between calls to process(), so a stream can be fed to it in blocks of any
+// size without discontinuities at the block boundaries. The output is aligned with the input, i.e. output sample k
+// corresponds to input time k * input_sample_rate / output_sample_rate. Since the filter needs to look ahead of that
+// time, the last few output samples are only produced once more input arrives, or when the resampler is flushed.
+class MEDIA_API Resampler {
+public:
+    enum class Quality : u8 {
+        // 16 taps per phase, roughly 60dB of stopband attenuation.
+        Fast,
+        // 32 taps per phase, roughly 80dB of stopband attenuation.
+        Medium,
+        // 64 taps per phase, roughly 100dB of stopband attenuation.
+        High,
+    };
+
+    static ErrorOr<NonnullOwnPtr<Resampler>> create(u32 input_sample_rate, u32 output_sample_rate, u8 channel_count, Quality = Quality::Medium);
+
+    u32 input_sample_rate() const { return m_input_sample_rate; }
+    u32 output_sample_rate() const { return m_output_sample_rate; }
+    u8 channel_count() const { return m_channel_count; }
+    size_t tap_count() const { return m_tap_count; }
+
+    // Resamples the interleaved input and appends every output sample that can be computed so far to the output.
+    ErrorOr<void> process(ReadonlySpan<float> input, Vector<float>& output);
+
+    // Appends the output samples that are still held back waiting for more input, and then resets the resampler.
+    ErrorOr<void> flush(Vector<float>& output);
+
+    // Drops all buffered input, so that the next call to process() starts a new stream.
+    void reset();
+
+private:
+    Resampler(u32 input_sample_rate, u32 output_sample_rate, u8 channel_count, u64 input_step, u64 output_step, size_t tap_count, size_t phase_count, FixedArray<float> coefficients, Vector<Vector<float>> channel_buffers);
+
+    ErrorOr<void> produce_output(Vector<float>& output, bool is_flushing);
+
+    ReadonlySpan<float> coefficients_for_phase(u64 phase) const;
+
+    u32 m_input_sample_rate { 0 };
+    u32 m_output_sample_rate { 0 };
+    u8 m_channel_count { 0 };
+
+    // The ratio between the sample rates, reduced to lowest terms. Each output sample advances the input time by
+    // m_input_step / m_output_step input samples.
+    u64 m_input_step { 0 };
+    u64 m_output_step { 0 };
+
+    size_t m_tap_count { 0 };
+    size_t m_phase_count { 0 };
+    // The filter's coefficients, with m_tap_count coefficients for each of the m_phase_count phases.
+    FixedArray<float> m_coefficients;
+
+    // The input samples that may still be needed to compute outputs, one buffer per channel.
+    Vector<Vector<float>> m_channel_buffers;
+    // The index into the channel buffers of the input sample at or right before the next output's time, and the
+    // fractional part of that time in units of 1 / m_output_step.
+    size_t m_position { 0 };
+    u64 m_phase { 0 };
+
+    u64 m_input_count { 0 };
+    u64 m_output_count { 0 };
+};
+
+}
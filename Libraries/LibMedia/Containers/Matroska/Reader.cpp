@@ -9,6 +9,7 @@
 #include <AK/Function.h>
 #include <AK/IntegralMath.h>
 #include <AK/Math.h>
+#include <AK/MemMem.h>
 #include <AK/Optional.h>
 #include <AK/Time.h>
 #include <AK/Utf8View.h>
@@ -96,6 +97,13 @@ constexpr u32 CUE_RELATIVE_POSITION_ID = 0xF0;
 constexpr u32 CUE_CODEC_STATE_ID = 0xEA;
 constexpr u32 CUE_REFERENCE_ID = 0xDB;
 
+// When seeking without cues, the clusters are bisected by their position in the file until the range that the target
+// timestamp is in is this small. The rest of the range is then read sequentially to find the keyframe to start from.
+static constexpr size_t LINEAR_SEEK_THRESHOLD = 1 * MiB;
+
+// How far ahead of the sample iterator the kernel is asked to page in a memory-mapped file.
+static constexpr size_t READ_AHEAD_SIZE = 16 * MiB;
+
 DecoderErrorOr<Reader> Reader::from_file(StringView path)
 {
     auto mapped_file = DECODER_TRY(DecoderErrorCategory::IO, Core::MappedFile::map(path));
@@ -884,18 +892,80 @@ static DecoderErrorOr<Block> parse_block_group(Streamer& streamer, AK::Duration
     return block;
 }
 
-DecoderErrorOr<SampleIterator> Reader::create_sample_iterator(u64 track_number)
+// Returns the index of the first item that the predicate returns false for. The predicate must return true for all
+// items before that one, and false for all items after it.
+template<typename T, typename Predicate>
+static size_t partition_point(Span<T> items, Predicate predicate)
+{
+    size_t low = 0;
+    size_t high = items.size();
+    while (low < high) {
+        auto middle = low + ((high - low) / 2);
+        if (predicate(items[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+ErrorOr<void> ClusterIndex::add(size_t position, AK::Duration timestamp)
+{
+    // During playback, clusters are found in order, so this is the common case.
+    if (m_entries.is_empty() || m_entries.last().position < position)
+        return m_entries.try_append(Entry { position, timestamp });
+
+    auto index = partition_point(m_entries.span(), [&](Entry const& entry) { return entry.position < position; });
+    if (m_entries[index].position == position)
+        return {};
+    return m_entries.try_insert(index, Entry { position, timestamp });
+}
+
+Optional<ClusterIndex::Entry> ClusterIndex::last_cluster_at_or_before(AK::Duration timestamp) const
+{
+    auto index = partition_point(m_entries.span(), [&](Entry const& entry) { return entry.timestamp <= timestamp; });
+    if (index == 0)
+        return {};
+    return m_entries[index - 1];
+}
+
+Optional<ClusterIndex::Entry> ClusterIndex::first_cluster_after(AK::Duration timestamp) const
+{
+    auto index = partition_point(m_entries.span(), [&](Entry const& entry) { return entry.timestamp <= timestamp; });
+    if (index == m_entries.size())
+        return {};
+    return m_entries[index];
+}
+
+Optional<ClusterIndex::Entry> ClusterIndex::last_cluster_before_position(size_t position) const
+{
+    auto index = partition_point(m_entries.span(), [&](Entry const& entry) { return entry.position < position; });
+    if (index == 0)
+        return {};
+    return m_entries[index - 1];
+}
+
+DecoderErrorOr<size_t> Reader::first_cluster_position()
 {
     auto optional_position = TRY(find_first_top_level_element_with_id("Cluster"sv, CLUSTER_ELEMENT_ID));
     if (!optional_position.has_value())
         return DecoderError::corrupted("No clusters are present in the segment"sv);
-    ReadonlyBytes segment_view = m_data.slice(m_segment_contents_position, m_segment_contents_size);
 
     // We need to have the element ID included so that the iterator knows where it is.
-    auto position = optional_position.value() - get_element_id_size(CLUSTER_ELEMENT_ID) - m_segment_contents_position;
+    return optional_position.value() - get_element_id_size(CLUSTER_ELEMENT_ID) - m_segment_contents_position;
+}
+
+DecoderErrorOr<SampleIterator> Reader::create_sample_iterator(u64 track_number)
+{
+    return create_sample_iterator_at_position(track_number, TRY(first_cluster_position()));
+}
+
+DecoderErrorOr<SampleIterator> Reader::create_sample_iterator_at_position(u64 track_number, size_t position)
+{
+    ReadonlyBytes segment_view = m_data.slice(m_segment_contents_position, m_segment_contents_size);
 
     dbgln_if(MATROSKA_DEBUG, "Creating sample iterator starting at {} relative to segment at {}", position, m_segment_contents_position);
-    return SampleIterator(this->m_mapped_file, segment_view, TRY(track_for_track_number(track_number)), TRY(segment_information()).timestamp_scale(), position);
+    return SampleIterator(m_mapped_file, segment_view, m_cluster_index, TRY(track_for_track_number(track_number)), TRY(segment_information()).timestamp_scale(), position);
 }
 
 static DecoderErrorOr<CueTrackPosition> parse_cue_track_position(Streamer& streamer)
@@ -1022,8 +1092,11 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
     if (m_cues_have_been_parsed)
         return {};
     auto position = TRY(find_first_top_level_element_with_id("Cues"sv, CUES_ID));
-    if (!position.has_value())
-        return DecoderError::corrupted("No Tracks element found"sv);
+    if (!position.has_value()) {
+        // Cues are optional, seeking will search the clusters instead.
+        m_cues_have_been_parsed = true;
+        return {};
+    }
     Streamer streamer { m_data };
     TRY_READ(streamer.seek_to_position(position.release_value()));
     TRY(parse_cues(streamer));
@@ -1034,76 +1107,133 @@ DecoderErrorOr<void> Reader::ensure_cues_are_parsed()
 DecoderErrorOr<void> Reader::seek_to_cue_for_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
 {
     auto const& cue_points = MUST(cue_points_for_track(iterator.m_track->track_number())).release_value();
+    VERIFY(!cue_points.is_empty());
 
-    // Take a guess at where in the cues the timestamp will be and correct from there.
-    auto duration = TRY(segment_information()).duration();
-    size_t index = 0;
-    if (duration.has_value())
-        index = clamp(((timestamp.to_nanoseconds() * cue_points.size()) / TRY(segment_information()).duration()->to_nanoseconds()), 0, cue_points.size() - 1);
-
-    CuePoint const* prev_cue_point = &cue_points[index];
-    dbgln_if(MATROSKA_DEBUG, "Finding Matroska cue points for timestamp {}ms starting from cue at {}ms", timestamp.to_milliseconds(), prev_cue_point->timestamp().to_milliseconds());
-
-    if (prev_cue_point->timestamp() == timestamp) {
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
-        return {};
-    }
+    // Use the last cue point at or before the timestamp, or the first one if the timestamp precedes all of them.
+    auto index = partition_point(cue_points.span(), [&](CuePoint const& cue_point) { return cue_point.timestamp() <= timestamp; });
+    auto const& cue_point = cue_points[index > 0 ? index - 1 : 0];
+    dbgln_if(MATROSKA_DEBUG, "Found Matroska cue point at {}ms for timestamp {}ms", cue_point.timestamp().to_milliseconds(), timestamp.to_milliseconds());
 
-    if (prev_cue_point->timestamp() > timestamp) {
-        while (index > 0 && prev_cue_point->timestamp() > timestamp) {
-            prev_cue_point = &cue_points[--index];
-            dbgln_if(MATROSKA_DEBUG, "Checking previous cue point {}ms", prev_cue_point->timestamp().to_milliseconds());
-        }
-        TRY(iterator.seek_to_cue_point(*prev_cue_point));
-        return {};
-    }
-
-    while (++index < cue_points.size()) {
-        auto const& cue_point = cue_points[index];
-        dbgln_if(MATROSKA_DEBUG, "Checking future cue point {}ms", cue_point.timestamp().to_milliseconds());
-        if (cue_point.timestamp() > timestamp)
-            break;
-        prev_cue_point = &cue_point;
-    }
-
-    TRY(iterator.seek_to_cue_point(*prev_cue_point));
+    TRY(iterator.seek_to_cue_point(cue_point));
     return {};
 }
 
-static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+// Reads blocks from the iterator until one is after the timestamp, and returns an iterator that will return the last
+// keyframe at or before the timestamp next. If no keyframe was found before the timestamp, returns nothing.
+static DecoderErrorOr<Optional<SampleIterator>> find_keyframe_before_timestamp(SampleIterator iterator, AK::Duration const& timestamp)
 {
-#if MATROSKA_DEBUG
-    size_t inter_frames_count;
-#endif
     Optional<SampleIterator> last_keyframe;
+    [[maybe_unused]] size_t inter_frames_count = 0;
 
     while (true) {
         SampleIterator rewind_iterator = iterator;
-        auto block = TRY(iterator.next_block());
+        auto block_or_error = iterator.next_block();
+        if (block_or_error.is_error()) {
+            if (block_or_error.error().category() == DecoderErrorCategory::EndOfStream)
+                break;
+            return block_or_error.release_error();
+        }
+        auto block = block_or_error.release_value();
+
+        if (block.timestamp() > timestamp)
+            break;
 
         if (block.only_keyframes()) {
-            last_keyframe.emplace(rewind_iterator);
-#if MATROSKA_DEBUG
+            last_keyframe.emplace(move(rewind_iterator));
             inter_frames_count = 0;
-#endif
+        } else {
+            inter_frames_count++;
         }
+    }
 
-        if (block.timestamp() > timestamp)
+    if (last_keyframe.has_value())
+        dbgln_if(MATROSKA_DEBUG, "Seeked to a keyframe with {} inter frames to skip", inter_frames_count);
+    return last_keyframe;
+}
+
+// Parses the cluster whose element ID is at the given position, if there is a plausible one.
+static Optional<Cluster> try_parse_cluster_at(ReadonlyBytes segment_view, size_t position, u64 timestamp_scale)
+{
+    Streamer streamer { segment_view };
+    if (streamer.seek_to_position(position + get_element_id_size(CLUSTER_ELEMENT_ID)).is_error())
+        return {};
+
+    // Clusters may have an unknown size, in which case all bits of the size are set. Otherwise, the cluster must fit
+    // within the segment.
+    auto size_position = streamer.position();
+    auto size = streamer.read_variable_size_integer();
+    if (size.is_error())
+        return {};
+    auto size_length = streamer.position() - size_position;
+    auto unknown_size = (1ull << (7 * size_length)) - 1;
+    if (size.value() != unknown_size && size.value() > streamer.remaining())
+        return {};
+
+    MUST(streamer.seek_to_position(size_position));
+    auto cluster = parse_cluster(streamer, timestamp_scale);
+    if (cluster.is_error())
+        return {};
+    return cluster.release_value();
+}
+
+DecoderErrorOr<Optional<ClusterIndex::Entry>> Reader::find_next_cluster(size_t start_position, size_t end_position)
+{
+    static constexpr Array<u8, 4> cluster_element_id_bytes { 0x1F, 0x43, 0xB6, 0x75 };
+    static_assert(get_element_id_size(CLUSTER_ELEMENT_ID) == cluster_element_id_bytes.size());
+
+    auto segment_view = m_data.slice(m_segment_contents_position, m_segment_contents_size);
+    auto timestamp_scale = TRY(segment_information()).timestamp_scale();
+    auto search_end = min(end_position + cluster_element_id_bytes.size() - 1, segment_view.size());
+
+    auto position = start_position;
+    while (position < end_position && position < search_end) {
+        auto offset = AK::memmem_optional(segment_view.offset_pointer(position), search_end - position, cluster_element_id_bytes.data(), cluster_element_id_bytes.size());
+        if (!offset.has_value())
             break;
+        auto candidate_position = position + offset.value();
+
+        // The element ID may also occur by chance within frame data, so only accept a cluster that parses, and that
+        // doesn't go back in time relative to the clusters we already know of.
+        auto cluster = try_parse_cluster_at(segment_view, candidate_position, timestamp_scale);
+        if (cluster.has_value()) {
+            auto previous_cluster = m_cluster_index->last_cluster_before_position(candidate_position);
+            if (!previous_cluster.has_value() || previous_cluster->timestamp <= cluster->timestamp())
+                return ClusterIndex::Entry { candidate_position, cluster->timestamp() };
+        }
 
-#if MATROSKA_DEBUG
-        inter_frames_count++;
-#endif
+        position = candidate_position + 1;
     }
 
-    if (last_keyframe.has_value()) {
-#if MATROSKA_DEBUG
-        dbgln("Seeked to a keyframe with {} inter frames to skip", inter_frames_count);
-#endif
-        iterator = last_keyframe.release_value();
+    return OptionalNone {};
+}
+
+DecoderErrorOr<size_t> Reader::find_cluster_position_for_timestamp(AK::Duration timestamp)
+{
+    // Start with the closest clusters on either side of the timestamp that we already know of.
+    auto lower_position = TRY(first_cluster_position());
+    if (auto cluster = m_cluster_index->last_cluster_at_or_before(timestamp); cluster.has_value())
+        lower_position = max(lower_position, cluster->position);
+    size_t upper_position = m_segment_contents_size;
+    if (auto cluster = m_cluster_index->first_cluster_after(timestamp); cluster.has_value())
+        upper_position = cluster->position;
+
+    while (upper_position > lower_position && upper_position - lower_position > LINEAR_SEEK_THRESHOLD) {
+        auto middle_position = lower_position + ((upper_position - lower_position) / 2);
+        auto cluster = TRY(find_next_cluster(middle_position, upper_position));
+        if (!cluster.has_value()) {
+            upper_position = middle_position;
+            continue;
+        }
+
+        dbgln_if(MATROSKA_DEBUG, "Bisecting clusters for timestamp {}ms found a cluster at {}ms", timestamp.to_milliseconds(), cluster->timestamp.to_milliseconds());
+        DECODER_TRY_ALLOC(m_cluster_index->add(cluster->position, cluster->timestamp));
+        if (cluster->timestamp <= timestamp)
+            lower_position = cluster->position;
+        else
+            upper_position = cluster->position;
     }
 
-    return {};
+    return lower_position;
 }
 
 DecoderErrorOr<bool> Reader::has_cues_for_track(u64 track_number)
@@ -1116,21 +1246,39 @@ DecoderErrorOr<SampleIterator> Reader::seek_to_random_access_point(SampleIterato
 {
     timestamp -= AK::Duration::from_nanoseconds(AK::clamp_to<i64>(iterator.m_track->seek_pre_roll()));
 
-    if (TRY(has_cues_for_track(iterator.m_track->track_number()))) {
+    auto track_number = iterator.m_track->track_number();
+    if (TRY(has_cues_for_track(track_number))) {
         TRY(seek_to_cue_for_timestamp(iterator, timestamp));
         VERIFY(iterator.last_timestamp().has_value());
         return iterator;
     }
 
-    if (!iterator.last_timestamp().has_value() || timestamp < iterator.last_timestamp().value()) {
-        // If the timestamp is before the iterator's current position, then we need to start from the beginning of the Segment.
-        iterator = TRY(create_sample_iterator(iterator.m_track->track_number()));
-        TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
-        return iterator;
+    auto cluster_position = TRY(find_cluster_position_for_timestamp(timestamp));
+
+    // If the iterator is already between that cluster and the timestamp, there is no need to read the clusters it has
+    // already passed again.
+    if (iterator.last_timestamp().has_value() && iterator.last_timestamp().value() <= timestamp && iterator.m_position > cluster_position) {
+        auto keyframe_iterator = TRY(find_keyframe_before_timestamp(iterator, timestamp));
+        if (keyframe_iterator.has_value())
+            return keyframe_iterator.release_value();
     }
 
-    TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
-    return iterator;
+    auto first_position = TRY(first_cluster_position());
+    while (true) {
+        auto keyframe_iterator = TRY(find_keyframe_before_timestamp(TRY(create_sample_iterator_at_position(track_number, cluster_position)), timestamp));
+        if (keyframe_iterator.has_value())
+            return keyframe_iterator.release_value();
+
+        // This track has no keyframes between the cluster and the timestamp, so we have to look further back.
+        if (auto previous_cluster = m_cluster_index->last_cluster_before_position(cluster_position); previous_cluster.has_value())
+            cluster_position = previous_cluster->position;
+        else if (cluster_position > first_position)
+            cluster_position = first_position;
+        else
+            break;
+    }
+
+    return create_sample_iterator(track_number);
 }
 
 DecoderErrorOr<Optional<Vector<CuePoint> const&>> Reader::cue_points_for_track(u64 track_number)
@@ -1150,17 +1298,14 @@ DecoderErrorOr<Block> SampleIterator::next_block()
     Optional<Block> block;
 
     while (streamer.has_octet()) {
-#if MATROSKA_TRACE_DEBUG
         auto element_position = streamer.position();
-#endif
         auto element_id = TRY_READ(streamer.read_variable_size_integer(false));
-#if MATROSKA_TRACE_DEBUG
-        dbgln("Iterator found element with ID {:#010x} at offset {} within the segment.", element_id, element_position);
-#endif
+        dbgln_if(MATROSKA_TRACE_DEBUG, "Iterator found element with ID {:#010x} at offset {} within the segment.", element_id, element_position);
 
         if (element_id == CLUSTER_ELEMENT_ID) {
             dbgln_if(MATROSKA_DEBUG, "  Iterator is parsing new cluster.");
             m_current_cluster = TRY(parse_cluster(streamer, m_segment_timestamp_scale));
+            TRY(did_enter_cluster(element_position));
         } else if (element_id == SIMPLE_BLOCK_ID) {
             dbgln_if(MATROSKA_TRACE_DEBUG, "  Iterator is parsing a new simple block.");
             auto candidate_block = TRY(parse_simple_block(streamer, m_current_cluster->timestamp(), m_segment_timestamp_scale, m_track));
@@ -1200,6 +1345,7 @@ DecoderErrorOr<void> SampleIterator::seek_to_cue_point(CuePoint const& cue_point
         return DecoderError::corrupted("Cue point's cluster position didn't point to a cluster"sv);
 
     m_current_cluster = TRY(parse_cluster(streamer, m_segment_timestamp_scale));
+    TRY(did_enter_cluster(cue_position.cluster_position()));
     dbgln_if(MATROSKA_DEBUG, "SampleIterator set to cue point at timestamp {}ms", m_current_cluster->timestamp().to_milliseconds());
 
     m_position = streamer.position() + cue_position.block_offset();
@@ -1207,6 +1353,27 @@ DecoderErrorOr<void> SampleIterator::seek_to_cue_point(CuePoint const& cue_point
     return {};
 }
 
+DecoderErrorOr<void> SampleIterator::did_enter_cluster(size_t cluster_position)
+{
+    DECODER_TRY_ALLOC(m_cluster_index->add(cluster_position, m_current_cluster->timestamp()));
+    read_ahead_from(cluster_position);
+    return {};
+}
+
+void SampleIterator::read_ahead_from(size_t position)
+{
+    if (!m_file)
+        return;
+
+    // Keep at least half of the read-ahead window ahead of the iterator, so that playback doesn't stall on page faults.
+    if (position >= m_read_ahead_start && position < m_read_ahead_end && m_read_ahead_end - position >= READ_AHEAD_SIZE / 2)
+        return;
+
+    m_read_ahead_start = position;
+    m_read_ahead_end = min(position + READ_AHEAD_SIZE, m_data.size());
+    m_file->file().advise_will_need(m_data.slice(m_read_ahead_start, m_read_ahead_end - m_read_ahead_start));
+}
+
 ErrorOr<String> Streamer::read_string()
 {
     auto string_length = TRY(read_variable_size_integer());
@@ -10,6 +10,8 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
 #include <LibCore/MappedFile.h>
 #include <LibMedia/DecoderError.h>
 #include <LibMedia/Export.h>
@@ -21,6 +23,31 @@ namespace Media::Matroska {
 class SampleIterator;
 class Streamer;
 
+// A sparse index of the clusters that have been found in a segment so far. It is filled in as clusters are parsed
+// during playback and seeking, and is used to narrow down the range of the file that has to be searched when seeking
+// in a file without cues. It is shared between a Reader and all of its SampleIterators, which must not be used from
+// multiple threads at once.
+class MEDIA_API ClusterIndex : public RefCounted<ClusterIndex> {
+public:
+    struct Entry {
+        // The position of the cluster's element ID, relative to the start of the segment's contents.
+        size_t position { 0 };
+        AK::Duration timestamp;
+    };
+
+    ErrorOr<void> add(size_t position, AK::Duration timestamp);
+
+    Optional<Entry> last_cluster_at_or_before(AK::Duration) const;
+    Optional<Entry> first_cluster_after(AK::Duration) const;
+    Optional<Entry> last_cluster_before_position(size_t) const;
+
+    size_t size() const { return m_entries.size(); }
+
+private:
+    // Sorted by position. Since cluster timestamps increase throughout a segment, this is also sorted by timestamp.
+    Vector<Entry> m_entries;
+};
+
 class MEDIA_API Reader {
 public:
     typedef Function<DecoderErrorOr<IterationDecision>(TrackEntry const&)> TrackEntryCallback;
@@ -47,6 +74,7 @@ public:
 private:
     Reader(ReadonlyBytes data)
         : m_data(data)
+        , m_cluster_index(make_ref_counted<ClusterIndex>())
     {
     }
 
@@ -63,6 +91,11 @@ private:
     DecoderErrorOr<void> ensure_cues_are_parsed();
     DecoderErrorOr<void> seek_to_cue_for_timestamp(SampleIterator&, AK::Duration const&);
 
+    DecoderErrorOr<size_t> first_cluster_position();
+    DecoderErrorOr<SampleIterator> create_sample_iterator_at_position(u64 track_number, size_t position);
+    DecoderErrorOr<Optional<ClusterIndex::Entry>> find_next_cluster(size_t start_position, size_t end_position);
+    DecoderErrorOr<size_t> find_cluster_position_for_timestamp(AK::Duration);
+
     RefPtr<Core::SharedMappedFile> m_mapped_file;
     ReadonlyBytes m_data;
 
@@ -81,6 +114,8 @@ private:
     // The vectors must be sorted by timestamp at all times.
     HashMap<u64, Vector<CuePoint>> m_cues;
     bool m_cues_have_been_parsed { false };
+
+    NonnullRefPtr<ClusterIndex> m_cluster_index;
 };
 
 class MEDIA_API SampleIterator {
@@ -93,9 +128,10 @@ public:
 private:
     friend class Reader;
 
-    SampleIterator(RefPtr<Core::SharedMappedFile> file, ReadonlyBytes data, TrackEntry& track, u64 timestamp_scale, size_t position)
+    SampleIterator(RefPtr<Core::SharedMappedFile> file, ReadonlyBytes data, NonnullRefPtr<ClusterIndex> cluster_index, TrackEntry& track, u64 timestamp_scale, size_t position)
         : m_file(move(file))
         , m_data(data)
+        , m_cluster_index(move(cluster_index))
         , m_track(track)
         , m_segment_timestamp_scale(timestamp_scale)
         , m_position(position)
@@ -103,12 +139,19 @@ private:
     }
 
     DecoderErrorOr<void> seek_to_cue_point(CuePoint const& cue_point);
+    DecoderErrorOr<void> did_enter_cluster(size_t cluster_position);
+    void read_ahead_from(size_t position);
 
     RefPtr<Core::SharedMappedFile> m_file;
     ReadonlyBytes m_data;
+    NonnullRefPtr<ClusterIndex> m_cluster_index;
     NonnullRefPtr<TrackEntry> m_track;
     u64 m_segment_timestamp_scale { 0 };
 
+    // The range of the segment that the kernel has last been asked to page in ahead of the iterator.
+    size_t m_read_ahead_start { 0 };
+    size_t m_read_ahead_end { 0 };
+
     // Must always point to an element ID or the end of the stream.
     size_t m_position { 0 };
 
@@ -12,6 +12,9 @@
 
 namespace Media::FFmpeg {
 
+// Beyond this, frame threading mostly adds latency and memory usage, even for 4K content.
+static constexpr unsigned MAX_DECODER_THREAD_COUNT = 8;
+
 static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
 {
     while (*formats >= 0) {
@@ -61,7 +64,10 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
 
     codec_context->get_format = negotiate_output_format;
     codec_context->time_base = { 1, 1'000'000 };
-    codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
+    // Frame threading decodes several frames at once at the cost of a few frames of latency, which the provider's
+    // queues hide. Slice threading is used for codecs or streams that can't be frame threaded.
+    codec_context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+    codec_context->thread_count = static_cast<int>(clamp(Core::System::hardware_concurrency(), 1u, MAX_DECODER_THREAD_COUNT));
 
     if (!codec_initialization_data.is_empty()) {
         if (codec_initialization_data.size() > NumericLimits<int>::max())
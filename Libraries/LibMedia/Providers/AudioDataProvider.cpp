@@ -6,6 +6,7 @@
 
 #include <AK/Debug.h>
 #include <LibCore/EventLoop.h>
+#include <LibMedia/Audio/Resampler.h>
 #include <LibMedia/FFmpeg/FFmpegAudioDecoder.h>
 #include <LibMedia/MutexedDemuxer.h>
 #include <LibMedia/Sinks/AudioSink.h>
@@ -68,6 +69,11 @@ AudioDataProvider::ThreadData::ThreadData(NonnullRefPtr<MutexedDemuxer> const& d
 
 AudioDataProvider::ThreadData::~ThreadData() = default;
 
+void AudioDataProvider::set_output_sample_rate(u32 sample_rate)
+{
+    m_thread_data->set_output_sample_rate(sample_rate);
+}
+
 void AudioDataProvider::ThreadData::set_error_handler(ErrorHandler&& handler)
 {
     auto locker = take_lock();
@@ -77,12 +83,19 @@ void AudioDataProvider::ThreadData::set_error_handler(ErrorHandler&& handler)
 
 AudioBlock AudioDataProvider::retrieve_block()
 {
-    auto locker = m_thread_data->take_lock();
-    if (m_thread_data->queue().is_empty())
-        return AudioBlock();
     auto result = m_thread_data->queue().dequeue();
+    if (result.is_error()) {
+        // The dequeue may have destroyed blocks that were discarded by a seek, and the decoding thread may be waiting
+        // for that space to enqueue the blocks that follow the seek.
+        m_thread_data->wake();
+        return AudioBlock();
+    }
+
+    // NOTE: We don't take the lock here, so the decoding thread may miss this wakeup if it is just about to wait for
+    //       space in the queue. In that case, it will be woken by the next block we take, and the queue is deep enough
+    //       that this won't starve the output.
     m_thread_data->wake();
-    return result;
+    return result.release_value();
 }
 
 void AudioDataProvider::ThreadData::exit()
@@ -109,15 +122,98 @@ void AudioDataProvider::ThreadData::flush_decoder()
 {
     m_decoder->flush();
     m_last_sample = NumericLimits<i64>::min();
+    // The samples the resampler is holding back are from before the seek, so they're dropped along with it.
+    m_resampler = nullptr;
 }
 
 DecoderErrorOr<void> AudioDataProvider::ThreadData::retrieve_next_block(AudioBlock& block)
 {
-    TRY(m_decoder->write_next_block(block));
-    if (block.timestamp_in_samples() < m_last_sample)
-        block.set_timestamp_in_samples(m_last_sample);
-    m_last_sample = block.timestamp_in_samples() + static_cast<i64>(block.sample_count());
-    return {};
+    while (true) {
+        auto write_result = m_decoder->write_next_block(block);
+        if (write_result.is_error()) {
+            // At the end of the stream, the samples that the resampler is still holding back make up the last block.
+            if (write_result.error().category() == DecoderErrorCategory::EndOfStream && TRY(flush_resampler(block)))
+                return {};
+            return write_result.release_error();
+        }
+        if (block.timestamp_in_samples() < m_last_sample)
+            block.set_timestamp_in_samples(m_last_sample);
+        m_last_sample = block.timestamp_in_samples() + static_cast<i64>(block.sample_count());
+
+        // The resampler holds back the last few samples it has been given, so it may not have any output yet.
+        if (TRY(resample_block(block)))
+            return {};
+        block.clear();
+    }
+}
+
+// Returns false if the block was consumed by the resampler without producing any output.
+DecoderErrorOr<bool> AudioDataProvider::ThreadData::resample_block(AudioBlock& block)
+{
+    // Samples that a resampler we're done with is still holding back have to be played before this block.
+    auto queue_samples_held_by_resampler = [&] -> DecoderErrorOr<void> {
+        AudioBlock flushed_block;
+        if (TRY(flush_resampler(flushed_block)))
+            m_blocks_waiting_for_queue.append(move(flushed_block));
+        return {};
+    };
+
+    auto output_sample_rate = m_output_sample_rate.load();
+    if (output_sample_rate == 0 || block.sample_rate() == output_sample_rate) {
+        TRY(queue_samples_held_by_resampler());
+        return true;
+    }
+
+    auto first_sample = block.timestamp_in_samples();
+    auto can_continue_stream = m_resampler
+        && m_resampler->input_sample_rate() == block.sample_rate()
+        && m_resampler->output_sample_rate() == output_sample_rate
+        && m_resampler->channel_count() == block.channel_count()
+        && m_next_resampler_input_sample == first_sample;
+    if (!can_continue_stream) {
+        TRY(queue_samples_held_by_resampler());
+        m_resampler = DECODER_TRY_ALLOC(Audio::Resampler::create(block.sample_rate(), output_sample_rate, block.channel_count()));
+        m_next_resampler_output_sample = first_sample * output_sample_rate / block.sample_rate();
+    }
+    m_next_resampler_input_sample = first_sample + static_cast<i64>(block.sample_count());
+
+    m_resampled_data.clear_with_capacity();
+    DECODER_TRY_ALLOC(m_resampler->process(block.data().span(), m_resampled_data));
+    return take_resampled_data(block);
+}
+
+// Replaces the block with the output of the resampler, and returns false if the resampler didn't produce any output.
+DecoderErrorOr<bool> AudioDataProvider::ThreadData::take_resampled_data(AudioBlock& block)
+{
+    if (m_resampled_data.is_empty())
+        return false;
+
+    auto data = DECODER_TRY_ALLOC(AudioBlock::Data::create(m_resampled_data.span()));
+    auto sample_rate = m_resampler->output_sample_rate();
+    auto channel_count = m_resampler->channel_count();
+    auto timestamp_in_samples = m_next_resampler_output_sample;
+    m_next_resampler_output_sample += static_cast<i64>(data.size() / channel_count);
+
+    block.clear();
+    block.emplace(sample_rate, channel_count, AK::Duration::from_time_units(timestamp_in_samples, 1, sample_rate), [&](AudioBlock::Data& block_data) {
+        block_data = move(data);
+    });
+    block.set_timestamp_in_samples(timestamp_in_samples);
+    return true;
+}
+
+// Puts the samples that the resampler is holding back into the block and destroys the resampler. Returns false if it
+// wasn't holding back any samples.
+DecoderErrorOr<bool> AudioDataProvider::ThreadData::flush_resampler(AudioBlock& block)
+{
+    if (!m_resampler)
+        return false;
+
+    m_resampled_data.clear_with_capacity();
+    DECODER_TRY_ALLOC(m_resampler->flush(m_resampled_data));
+    auto result = TRY(take_resampled_data(block));
+    m_resampler = nullptr;
+    return result;
 }
 
 template<typename T>
@@ -131,6 +227,21 @@ void AudioDataProvider::ThreadData::process_seek_on_main_thread(u32 seek_id, T&&
     });
 }
 
+void AudioDataProvider::ThreadData::discard_queued_blocks()
+{
+    // NOTE: The blocks are destroyed by the next dequeue on the audio output thread. If we dequeued them here instead,
+    //       the audio output thread could have to wait for us to finish.
+    m_queue.discard_enqueued();
+    m_blocks_waiting_for_queue.clear();
+}
+
+bool AudioDataProvider::ThreadData::enqueue_waiting_blocks()
+{
+    while (!m_blocks_waiting_for_queue.is_empty() && m_queue.can_enqueue())
+        MUST(m_queue.enqueue(m_blocks_waiting_for_queue.take_first()));
+    return m_blocks_waiting_for_queue.is_empty();
+}
+
 void AudioDataProvider::ThreadData::resolve_seek(u32 seek_id)
 {
     process_seek_on_main_thread(seek_id, [self = NonnullRefPtr(*this)] {
@@ -152,10 +263,7 @@ bool AudioDataProvider::ThreadData::handle_seek()
         return false;
 
     auto handle_error = [&](DecoderError&& error) {
-        {
-            auto locker = take_lock();
-            m_queue.clear();
-        }
+        discard_queued_blocks();
 
         process_seek_on_main_thread(seek_id,
             [self = NonnullRefPtr(*this), error = move(error)] mutable {
@@ -221,13 +329,12 @@ bool AudioDataProvider::ThreadData::handle_seek()
                 }
 
                 if (current_block.timestamp() > timestamp) {
-                    auto locker = take_lock();
-                    m_queue.clear();
+                    discard_queued_blocks();
 
                     if (!last_block.is_empty())
-                        m_queue.enqueue(move(last_block));
-
-                    m_queue.enqueue(move(current_block));
+                        m_blocks_waiting_for_queue.append(move(last_block));
+                    m_blocks_waiting_for_queue.append(move(current_block));
+                    enqueue_waiting_blocks();
 
                     resolve_seek(seek_id);
                     return true;
@@ -287,12 +394,7 @@ void AudioDataProvider::ThreadData::push_data_and_decode_a_block()
     }
 
     while (true) {
-        auto queue_size = [&] {
-            auto locker = take_lock();
-            return m_queue.size();
-        }();
-
-        while (queue_size >= m_queue_max_size) {
+        while (!enqueue_waiting_blocks() || m_queue.weak_used() >= m_queue_max_size) {
             if (handle_seek())
                 return;
 
@@ -301,7 +403,6 @@ void AudioDataProvider::ThreadData::push_data_and_decode_a_block()
                 m_wait_condition.wait();
                 if (should_thread_exit())
                     return;
-                queue_size = m_queue.size();
             }
         }
 
@@ -316,10 +417,14 @@ void AudioDataProvider::ThreadData::push_data_and_decode_a_block()
 
         // FIXME: Specify trailing samples in the demuxer, and drop them here or in the audio decoder implementation.
 
-        auto locker = take_lock();
         VERIFY(!block.is_empty());
-        m_queue.enqueue(move(block));
-        VERIFY(!m_queue.tail().is_empty());
+
+        // If a resampler was flushed while retrieving this block, its samples have to be queued first.
+        if (!m_blocks_waiting_for_queue.is_empty()) {
+            m_blocks_waiting_for_queue.append(move(block));
+            continue;
+        }
+        MUST(m_queue.enqueue(move(block)));
     }
 }
 
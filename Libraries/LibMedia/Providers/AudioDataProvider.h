@@ -9,9 +9,11 @@
 #include <AK/AtomicRefCounted.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
-#include <AK/Queue.h>
+#include <AK/OwnPtr.h>
 #include <AK/Time.h>
 #include <LibCore/Forward.h>
+#include <LibCore/SingleProducerCircularQueue.h>
+#include <LibMedia/Audio/Forward.h>
 #include <LibMedia/AudioBlock.h>
 #include <LibMedia/DecoderError.h>
 #include <LibMedia/Export.h>
@@ -29,7 +31,10 @@ class MEDIA_API AudioDataProvider : public AtomicRefCounted<AudioDataProvider> {
 
 public:
     static constexpr size_t QUEUE_CAPACITY = 16;
-    using AudioQueue = Queue<AudioBlock, QUEUE_CAPACITY>;
+    // The decoding thread is the only producer. Blocks are consumed by the audio output thread, which must never wait
+    // for the decoding thread to release a lock, so this queue is lock-free, and the decoding thread never dequeues from
+    // it, even to discard blocks after a seek.
+    using AudioQueue = Core::SingleProducerCircularQueue<AudioBlock, QUEUE_CAPACITY>;
 
     using ErrorHandler = Function<void(DecoderError&&)>;
     using SeekCompletionHandler = Function<void()>;
@@ -40,10 +45,16 @@ public:
 
     void set_error_handler(ErrorHandler&&);
 
+    // Returns the next decoded block, or an empty block if none is ready yet. This never blocks, so it is safe to
+    // call from a real-time audio thread.
     AudioBlock retrieve_block();
 
     void seek(AK::Duration timestamp, SeekCompletionHandler&& = nullptr);
 
+    // Blocks decoded after this is called are resampled to the given sample rate on the decoding thread. A sample rate
+    // of 0 leaves the blocks at the rate they were decoded at.
+    void set_output_sample_rate(u32);
+
 private:
     class ThreadData final : public AtomicRefCounted<ThreadData> {
     public:
@@ -55,6 +66,11 @@ private:
         bool should_thread_exit() const;
         void flush_decoder();
         DecoderErrorOr<void> retrieve_next_block(AudioBlock&);
+        DecoderErrorOr<bool> resample_block(AudioBlock&);
+        DecoderErrorOr<bool> take_resampled_data(AudioBlock&);
+        DecoderErrorOr<bool> flush_resampler(AudioBlock&);
+        void discard_queued_blocks();
+        bool enqueue_waiting_blocks();
         bool handle_seek();
         template<typename T>
         void process_seek_on_main_thread(u32 seek_id, T&&);
@@ -65,6 +81,7 @@ private:
         void set_stopped(bool);
         bool is_stopped() const;
         void seek(AK::Duration timestamp, SeekCompletionHandler&&);
+        void set_output_sample_rate(u32 sample_rate) { m_output_sample_rate = sample_rate; }
 
         [[nodiscard]] Threading::MutexLocker take_lock() { return Threading::MutexLocker(m_mutex); }
         void wake() { m_wait_condition.broadcast(); }
@@ -84,8 +101,17 @@ private:
         NonnullOwnPtr<AudioDecoder> m_decoder;
         i64 m_last_sample { NumericLimits<i64>::min() };
 
+        Atomic<u32> m_output_sample_rate { 0 };
+        OwnPtr<Audio::Resampler> m_resampler;
+        i64 m_next_resampler_input_sample { 0 };
+        i64 m_next_resampler_output_sample { 0 };
+        Vector<float> m_resampled_data;
+
         size_t m_queue_max_size { 8 };
         AudioQueue m_queue;
+        // Blocks that follow a seek are held here until the blocks it discarded have been dequeued to make room. This also
+        // holds the samples flushed out of a resampler that was replaced, followed by the blocks decoded after it.
+        Vector<AudioBlock, 2> m_blocks_waiting_for_queue;
         ErrorHandler m_error_handler;
         bool m_is_in_error_state { false };
 
@@ -33,8 +33,15 @@ DecoderErrorOr<NonnullRefPtr<VideoDataProvider>> VideoDataProvider::try_create(N
         }
         return 0;
     }));
+    auto conversion_thread = DECODER_TRY_ALLOC(Threading::Thread::try_create([thread_data]() -> int {
+        while (!thread_data->should_thread_exit())
+            thread_data->convert_a_frame();
+        return 0;
+    }));
     thread->start();
     thread->detach();
+    conversion_thread->start();
+    conversion_thread->detach();
 
     return provider;
 }
@@ -63,13 +70,25 @@ void VideoDataProvider::set_error_handler(ErrorHandler&& handler)
 TimedImage VideoDataProvider::retrieve_frame()
 {
     auto locker = m_thread_data->take_lock();
-    if (m_thread_data->queue().is_empty())
+    if (m_thread_data->queue().is_empty()) {
+        m_thread_data->handle_empty_queue();
         return TimedImage();
+    }
     auto result = m_thread_data->take_frame();
     m_thread_data->wake();
     return result;
 }
 
+void VideoDataProvider::report_dropped_frames(u64 count)
+{
+    m_thread_data->report_dropped_frames(count);
+}
+
+VideoDataProvider::Statistics VideoDataProvider::statistics() const
+{
+    return m_thread_data->statistics();
+}
+
 void VideoDataProvider::seek(AK::Duration timestamp, SeekMode seek_mode, SeekCompletionHandler&& completion_handler)
 {
     m_thread_data->seek(timestamp, seek_mode, move(completion_handler));
@@ -106,9 +125,62 @@ VideoDataProvider::ImageQueue& VideoDataProvider::ThreadData::queue()
 
 TimedImage VideoDataProvider::ThreadData::take_frame()
 {
+    m_has_retrieved_frame_since_clear = true;
+    m_is_in_underrun = false;
+
+    // Once the display has kept up for a while, give back one of the frames that were added for an underrun.
+    static constexpr size_t FRAMES_BEFORE_SHRINKING_QUEUE = 300;
+    if (++m_frames_retrieved_since_underrun >= FRAMES_BEFORE_SHRINKING_QUEUE) {
+        m_frames_retrieved_since_underrun = 0;
+        if (m_queue_max_size > MIN_QUEUE_SIZE)
+            m_queue_max_size--;
+    }
+
     return m_queue.dequeue();
 }
 
+void VideoDataProvider::ThreadData::handle_empty_queue()
+{
+    // The queue is expected to be empty before the first frame after a seek, and once the stream has ended.
+    if (!m_has_retrieved_frame_since_clear || m_is_in_error_state || m_is_in_underrun)
+        return;
+
+    m_is_in_underrun = true;
+    m_frames_retrieved_since_underrun = 0;
+    m_underrun_count++;
+    if (m_queue_max_size < MAX_QUEUE_SIZE) {
+        m_queue_max_size++;
+        dbgln_if(PLAYBACK_MANAGER_DEBUG, "Video Data Provider: Ran out of frames, increasing the queue size to {}", m_queue_max_size);
+    }
+}
+
+void VideoDataProvider::ThreadData::clear_queues()
+{
+    m_queue.clear();
+    m_decoded_queue.clear();
+    m_queue_generation++;
+    m_conversion_error.clear();
+    m_has_retrieved_frame_since_clear = false;
+    m_is_in_underrun = false;
+    m_wait_condition.broadcast();
+}
+
+VideoDataProvider::Statistics VideoDataProvider::ThreadData::statistics()
+{
+    auto locker = take_lock();
+    return {
+        .decoded_frame_count = m_decoded_frame_count.load(),
+        .dropped_frame_count = m_dropped_frame_count.load(),
+        .underrun_count = m_underrun_count.load(),
+        .queue_size = m_queue_max_size,
+    };
+}
+
+void VideoDataProvider::ThreadData::report_dropped_frames(u64 count)
+{
+    m_dropped_frame_count += count;
+}
+
 void VideoDataProvider::ThreadData::seek(AK::Duration timestamp, SeekMode seek_mode, SeekCompletionHandler&& completion_handler)
 {
     auto locker = take_lock();
@@ -195,7 +267,7 @@ bool VideoDataProvider::ThreadData::handle_seek()
         m_is_in_error_state = true;
         {
             auto locker = take_lock();
-            m_queue.clear();
+            clear_queues();
         }
         process_seek_on_main_thread(seek_id,
             [self = NonnullRefPtr(*this), error = move(error)] mutable {
@@ -294,8 +366,10 @@ bool VideoDataProvider::ThreadData::handle_seek()
                 auto frame_result = m_decoder->get_decoded_frame();
                 if (frame_result.is_error()) {
                     if (frame_result.error().category() == DecoderErrorCategory::EndOfStream) {
-                        if (last_frame != nullptr)
+                        if (last_frame != nullptr) {
+                            auto locker = take_lock();
                             CONVERT_AND_QUEUE_A_FRAME(last_frame);
+                        }
 
                         resolve_seek(seek_id, timestamp);
                         return true;
@@ -312,7 +386,7 @@ bool VideoDataProvider::ThreadData::handle_seek()
                 set_cicp_values(*current_frame);
                 if (is_desired_decoded_frame(*current_frame)) {
                     auto locker = take_lock();
-                    m_queue.clear();
+                    clear_queues();
 
                     if (last_frame != nullptr)
                         CONVERT_AND_QUEUE_A_FRAME(last_frame);
@@ -364,6 +438,17 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
         }
     };
 
+    auto conversion_error = [&] -> Optional<DecoderError> {
+        auto locker = take_lock();
+        if (!m_conversion_error.has_value())
+            return {};
+        return m_conversion_error.release_value();
+    }();
+    if (conversion_error.has_value()) {
+        set_error_and_wait_for_seek(conversion_error.release_value());
+        return;
+    }
+
     auto sample_result = m_demuxer->get_next_sample_for_track(m_track);
     if (sample_result.is_error()) {
         if (sample_result.error().category() == DecoderErrorCategory::EndOfStream) {
@@ -392,20 +477,15 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
 
         auto frame = frame_result.release_value();
         set_cicp_values(*frame);
-        auto bitmap_result = frame->to_bitmap();
-
-        if (bitmap_result.is_error()) {
-            set_error_and_wait_for_seek(bitmap_result.release_error());
-            return;
-        }
+        m_decoded_frame_count++;
 
         {
             auto queue_size = [&] {
                 auto locker = take_lock();
-                return m_queue.size();
+                return m_decoded_queue.size();
             }();
 
-            while (queue_size >= m_queue_max_size) {
+            while (queue_size >= DECODED_QUEUE_CAPACITY) {
                 if (handle_seek())
                     return;
 
@@ -414,14 +494,55 @@ void VideoDataProvider::ThreadData::push_data_and_decode_some_frames()
                     m_wait_condition.wait();
                     if (should_thread_exit())
                         return;
-                    queue_size = m_queue.size();
+                    queue_size = m_decoded_queue.size();
                 }
             }
 
             auto locker = take_lock();
-            queue_frame(TimedImage(frame->timestamp(), bitmap_result.release_value()));
+            m_decoded_queue.enqueue(move(frame));
+            m_wait_condition.broadcast();
         }
     }
 }
 
+void VideoDataProvider::ThreadData::convert_a_frame()
+{
+    OwnPtr<VideoFrame> frame;
+    u32 generation = 0;
+
+    {
+        auto locker = take_lock();
+        while (m_decoded_queue.is_empty()) {
+            if (should_thread_exit())
+                return;
+            m_wait_condition.wait();
+        }
+        frame = m_decoded_queue.dequeue();
+        generation = m_queue_generation;
+        m_wait_condition.broadcast();
+    }
+
+    // The conversion is done without holding the lock, so that the decoding thread can continue in the meantime.
+    auto bitmap_result = frame->to_bitmap();
+
+    auto locker = take_lock();
+    while (generation == m_queue_generation && m_queue.size() >= m_queue_max_size) {
+        m_wait_condition.wait();
+        if (should_thread_exit())
+            return;
+    }
+
+    // If a seek cleared the queues while we were converting, this frame is no longer needed.
+    if (generation != m_queue_generation)
+        return;
+
+    if (bitmap_result.is_error()) {
+        m_conversion_error = bitmap_result.release_error();
+        m_wait_condition.broadcast();
+        return;
+    }
+
+    queue_frame(TimedImage(frame->timestamp(), bitmap_result.release_value()));
+}
+
 }
@@ -9,7 +9,9 @@
 #include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/Forward.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
 #include <AK/Queue.h>
 #include <AK/Time.h>
 #include <LibCore/Forward.h>
@@ -25,6 +27,10 @@
 namespace Media {
 
 // Retrieves coded data from a demuxer and decodes it asynchronously into video frames ready for display.
+//
+// Demuxing and decoding happen on one thread, while the decoder itself may use more threads internally. Decoded frames
+// are then handed to a second thread to be converted to bitmaps, so that color conversion of one frame can overlap
+// with decoding of the next.
 class MEDIA_API VideoDataProvider final : public AtomicRefCounted<VideoDataProvider> {
     class ThreadData;
 
@@ -32,6 +38,23 @@ public:
     static constexpr size_t QUEUE_CAPACITY = 8;
     using ImageQueue = Queue<TimedImage, QUEUE_CAPACITY>;
 
+    // The number of frames that are kept converted ahead of the playhead starts at the minimum, and grows up to the
+    // maximum whenever the display runs out of frames.
+    static constexpr size_t MIN_QUEUE_SIZE = 4;
+    static constexpr size_t MAX_QUEUE_SIZE = QUEUE_CAPACITY;
+
+    static constexpr size_t DECODED_QUEUE_CAPACITY = 4;
+    using DecodedFrameQueue = Queue<NonnullOwnPtr<VideoFrame>, DECODED_QUEUE_CAPACITY>;
+
+    struct Statistics {
+        u64 decoded_frame_count { 0 };
+        // Frames that were decoded, but were never displayed because a later frame was already due.
+        u64 dropped_frame_count { 0 };
+        // The number of times that the display needed a frame while none had been converted yet.
+        u64 underrun_count { 0 };
+        size_t queue_size { 0 };
+    };
+
     using ErrorHandler = Function<void(DecoderError&&)>;
     using SeekCompletionHandler = Function<void(AK::Duration)>;
 
@@ -45,6 +68,10 @@ public:
 
     TimedImage retrieve_frame();
 
+    // Called by the sink when it skips over frames it has retrieved without displaying them.
+    void report_dropped_frames(u64 count);
+    Statistics statistics() const;
+
     void seek(AK::Duration timestamp, SeekMode, SeekCompletionHandler&& = nullptr);
 
 private:
@@ -59,6 +86,11 @@ private:
 
         ImageQueue& queue();
         TimedImage take_frame();
+        void handle_empty_queue();
+        void clear_queues();
+
+        Statistics statistics();
+        void report_dropped_frames(u64 count);
 
         void seek(AK::Duration timestamp, SeekMode, SeekCompletionHandler&&);
 
@@ -70,6 +102,7 @@ private:
         void process_seek_on_main_thread(u32 seek_id, T&&);
         void resolve_seek(u32 seek_id, AK::Duration const& timestamp);
         void push_data_and_decode_some_frames();
+        void convert_a_frame();
 
         [[nodiscard]] Threading::MutexLocker take_lock() { return Threading::MutexLocker(m_mutex); }
         void wake() { m_wait_condition.broadcast(); }
@@ -87,11 +120,24 @@ private:
 
         RefPtr<MediaTimeProvider> m_time_provider;
 
-        size_t m_queue_max_size { 4 };
+        size_t m_queue_max_size { MIN_QUEUE_SIZE };
         ImageQueue m_queue;
+        DecodedFrameQueue m_decoded_queue;
+        // Incremented whenever the queues are cleared, so that the conversion thread can tell whether the frame it is
+        // converting is still wanted.
+        u32 m_queue_generation { 0 };
+        Optional<DecoderError> m_conversion_error;
         ErrorHandler m_error_handler;
         bool m_is_in_error_state { false };
 
+        bool m_has_retrieved_frame_since_clear { false };
+        bool m_is_in_underrun { false };
+        size_t m_frames_retrieved_since_underrun { 0 };
+
+        Atomic<u64, AK::MemoryOrder::memory_order_relaxed> m_decoded_frame_count { 0 };
+        Atomic<u64, AK::MemoryOrder::memory_order_relaxed> m_dropped_frame_count { 0 };
+        Atomic<u64, AK::MemoryOrder::memory_order_relaxed> m_underrun_count { 0 };
+
         u32 m_last_processed_seek_id { 0 };
         Atomic<u32> m_seek_id { 0 };
         SeekCompletionHandler m_seek_completion_handler;
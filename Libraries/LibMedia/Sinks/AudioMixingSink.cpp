@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Time.h>
 #include <LibMedia/Audio/PlaybackStream.h>
 #include <LibMedia/Providers/AudioDataProvider.h>
@@ -12,6 +14,69 @@
 
 namespace Media {
 
+// OPTIMIZATION: Blocks that are already in the output format make up nearly all of the audio we play, so mix them
+//               with vector adds.
+static void mix_samples(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() == source.size());
+
+    constexpr auto vector_length = SIMD::vector_length<SIMD::f32x4>;
+    size_t i = 0;
+    for (; i + vector_length <= destination.size(); i += vector_length) {
+        auto sum = SIMD::load_unaligned<SIMD::f32x4>(&destination[i]) + SIMD::load_unaligned<SIMD::f32x4>(&source[i]);
+        SIMD::store_unaligned(&destination[i], sum);
+    }
+    for (; i < destination.size(); i++)
+        destination[i] += source[i];
+}
+
+// Mixes a block with a different sample rate or channel count than the output into the destination, which starts at
+// the given output sample. The block's channels are mapped onto the output channels.
+// NOTE: Providers resample their blocks to the output's sample rate on their decoding thread, so this only has to
+//       resample the blocks that were decoded before the output was created. Linear interpolation is good enough
+//       for those few blocks.
+static void mix_converted_samples(Span<float> destination, u32 channel_count, i64 first_sample, u32 sample_rate, AudioBlock const& block)
+{
+    auto const& data = block.data();
+    auto block_channel_count = static_cast<u32>(block.channel_count());
+    auto block_sample_count = static_cast<i64>(block.sample_count());
+    auto block_samples_per_output_sample = static_cast<double>(block.sample_rate()) / sample_rate;
+
+    auto block_value = [&](i64 sample, u32 channel) {
+        auto const* frame = &data[sample * block_channel_count];
+        if (block_channel_count == channel_count)
+            return frame[channel];
+        // Mono blocks are played on every channel, and all channels are averaged for a mono output.
+        if (block_channel_count == 1)
+            return frame[0];
+        if (channel_count == 1) {
+            float sum = 0;
+            for (u32 i = 0; i < block_channel_count; i++)
+                sum += frame[i];
+            return sum / block_channel_count;
+        }
+        // Otherwise, channels that only exist on one side are dropped or left silent.
+        if (channel < block_channel_count)
+            return frame[channel];
+        return 0.0f;
+    };
+
+    auto output_sample_count = destination.size() / channel_count;
+    for (size_t i = 0; i < output_sample_count; i++) {
+        auto position = static_cast<double>(first_sample + static_cast<i64>(i)) * block_samples_per_output_sample - static_cast<double>(block.timestamp_in_samples());
+        position = clamp(position, 0.0, static_cast<double>(block_sample_count - 1));
+        auto index = static_cast<i64>(position);
+        auto next_index = min(index + 1, block_sample_count - 1);
+        auto fraction = static_cast<float>(position - static_cast<double>(index));
+
+        for (u32 channel = 0; channel < channel_count; channel++) {
+            auto value = block_value(index, channel);
+            value += (block_value(next_index, channel) - value) * fraction;
+            destination[(i * channel_count) + channel] += value;
+        }
+    }
+}
+
 ErrorOr<NonnullRefPtr<AudioMixingSink>> AudioMixingSink::try_create()
 {
     auto weak_ref = TRY(try_make_ref_counted<AudioMixingSinkWeakReference>());
@@ -64,6 +129,8 @@ void AudioMixingSink::set_provider(Track const& track, RefPtr<AudioDataProvider>
         return;
 
     m_track_mixing_datas.set(track, TrackMixingData(*provider));
+    if (m_playback_stream)
+        provider->set_output_sample_rate(m_playback_stream_sample_rate);
     deferred_create_playback_stream(track);
 }
 
@@ -101,15 +168,18 @@ void AudioMixingSink::create_playback_stream(u32 sample_rate, u32 channel_count)
             return buffer.trim(0);
 
         auto buffer_start = self->m_next_sample_to_write.load();
+        auto samples_end = buffer_start + static_cast<i64>(sample_count);
+        auto is_starved = false;
 
         for (auto& [track, track_data] : self->m_track_mixing_datas) {
             auto next_sample = buffer_start;
-            auto samples_end = next_sample + static_cast<i64>(sample_count);
 
             auto go_to_next_block = [&] {
                 auto new_block = track_data.provider->retrieve_block();
-                if (new_block.is_empty())
+                if (new_block.is_empty()) {
+                    is_starved = true;
                     return false;
+                }
 
                 track_data.current_block = move(new_block);
                 return true;
@@ -120,65 +190,69 @@ void AudioMixingSink::create_playback_stream(u32 sample_rate, u32 channel_count)
                     continue;
             }
 
-            while (!track_data.current_block.is_empty()) {
-                auto& current_block = track_data.current_block;
-                auto current_block_data_count = static_cast<i64>(current_block.data_count());
-                auto current_block_sample_count = static_cast<i64>(current_block.sample_count());
-
-                if (current_block.sample_rate() != sample_rate || current_block.channel_count() != channel_count) {
-                    current_block.clear();
-                    continue;
-                }
-
-                auto first_sample_offset = current_block.timestamp_in_samples();
-                if (first_sample_offset >= samples_end)
+            while (true) {
+                auto const& current_block = track_data.current_block;
+                auto block_sample_rate = current_block.sample_rate();
+                auto to_output_samples = [&](i64 block_samples) {
+                    if (block_sample_rate == sample_rate)
+                        return block_samples;
+                    return block_samples * sample_rate / block_sample_rate;
+                };
+
+                auto first_sample_in_block = current_block.timestamp_in_samples();
+                auto block_start = to_output_samples(first_sample_in_block);
+                if (block_start >= samples_end)
                     break;
 
-                auto block_end = first_sample_offset + current_block_sample_count;
+                next_sample = max(next_sample, block_start);
+                auto block_end = to_output_samples(first_sample_in_block + static_cast<i64>(current_block.sample_count()));
                 if (block_end <= next_sample) {
                     if (!go_to_next_block())
                         break;
                     continue;
                 }
 
-                next_sample = max(next_sample, first_sample_offset);
-
-                auto index_in_block = (next_sample - first_sample_offset) * channel_count;
-                VERIFY(index_in_block < current_block_data_count);
-                auto index_in_buffer = (next_sample - buffer_start) * channel_count;
-                VERIFY(index_in_buffer < float_buffer_count);
-                auto write_count = current_block_data_count - index_in_block;
-                write_count = min(write_count, float_buffer_count - index_in_buffer);
-                VERIFY(write_count > 0);
-                VERIFY(index_in_buffer + write_count <= float_buffer_count);
-                VERIFY(write_count % channel_count == 0);
+                auto write_end = min(block_end, samples_end);
 
-                for (i64 i = 0; i < write_count; i++)
-                    float_buffer[index_in_buffer + i] += current_block.data()[index_in_block + i];
+                auto index_in_buffer = static_cast<size_t>(next_sample - buffer_start) * channel_count;
+                auto write_count = static_cast<size_t>(write_end - next_sample) * channel_count;
+                auto destination = float_buffer.slice(index_in_buffer, write_count);
 
-                auto write_end = index_in_block + write_count;
-                if (write_end == current_block_data_count) {
-                    if (!go_to_next_block())
-                        break;
-                    continue;
+                if (block_sample_rate == sample_rate && current_block.channel_count() == channel_count) {
+                    auto index_in_block = static_cast<size_t>(next_sample - block_start) * channel_count;
+                    mix_samples(destination, current_block.data().span().slice(index_in_block, write_count));
+                } else {
+                    mix_converted_samples(destination, channel_count, next_sample, sample_rate, current_block);
                 }
-                VERIFY(write_end < current_block_data_count);
 
-                next_sample += write_count / channel_count;
+                next_sample = write_end;
                 if (next_sample == samples_end)
                     break;
-                VERIFY(next_sample < samples_end);
+                if (!go_to_next_block())
+                    break;
             }
         }
 
+        if (is_starved)
+            self->m_underrun_count++;
+
         self->m_next_sample_to_write += static_cast<i64>(sample_count);
         return buffer.slice(0, float_buffer_size);
     };
     constexpr u32 target_latency_ms = 100;
     m_playback_stream = MUST(Audio::PlaybackStream::create(Audio::OutputState::Suspended, sample_rate, channel_count, target_latency_ms, move(callback)));
+    m_playback_stream->set_underrun_callback([weak_self = m_weak_self] {
+        auto self = weak_self->take_strong();
+        if (!self)
+            return;
+        self->m_xrun_count++;
+    });
     m_playback_stream_sample_rate = sample_rate;
     m_playback_stream_channel_count = channel_count;
 
+    for (auto& [track, track_data] : m_track_mixing_datas)
+        track_data.provider->set_output_sample_rate(sample_rate);
+
     if (m_playing)
         resume();
 
@@ -42,6 +42,11 @@ public:
 
     void set_volume(double);
 
+    // The number of times the output requested audio while a track had no decoded audio ready for it.
+    u64 underrun_count() const { return m_underrun_count.load(); }
+    // The number of times the audio output ran out of buffered audio, as reported by the playback stream.
+    u64 xrun_count() const { return m_xrun_count.load(); }
+
 private:
     static constexpr size_t MAX_BLOCK_COUNT = 16;
 
@@ -92,6 +97,9 @@ private:
     HashMap<Track, TrackMixingData> m_track_mixing_datas;
     Atomic<i64, MemoryOrder::memory_order_relaxed> m_next_sample_to_write { 0 };
 
+    Atomic<u64, MemoryOrder::memory_order_relaxed> m_underrun_count { 0 };
+    Atomic<u64, MemoryOrder::memory_order_relaxed> m_xrun_count { 0 };
+
     AK::Duration m_last_stream_time;
     AK::Duration m_last_media_time;
     Optional<AK::Duration> m_temporary_time;
@@ -57,6 +57,7 @@ DisplayingVideoSinkUpdateResult DisplayingVideoSink::update()
         m_cleared_current_frame = false;
     }
 
+    u64 replaced_frames = 0;
     while (true) {
         if (!m_next_frame.is_valid()) {
             m_next_frame = m_provider->retrieve_frame();
@@ -67,7 +68,12 @@ DisplayingVideoSinkUpdateResult DisplayingVideoSink::update()
             break;
         m_current_frame = m_next_frame.release_image();
         result = DisplayingVideoSinkUpdateResult::NewFrameAvailable;
+        replaced_frames++;
     }
+
+    // Only the last frame that was due will be displayed, so any frames before it were dropped.
+    if (replaced_frames > 1)
+        m_provider->report_dropped_frames(replaced_frames - 1);
     return result;
 }
 
@@ -213,6 +213,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // If the whole pattern is a plain string, we can jump straight to its next occurrence in the input instead of
+    // attempting a match at every position in between.
+    Optional<Utf16View> pure_substring_search;
+    if (auto const& substring = m_pattern->parser_result.optimization_data.pure_substring_search; substring.has_value() && !substring->is_empty()) {
+        if (continue_search
+            && !input.regex_options.has_flag_set(AllFlags::Insensitive)
+            && !input.regex_options.has_flag_set(AllFlags::Multiline)
+            && views.size() == 1 && views.first().is_u16_view() && !views.first().unicode()) {
+            pure_substring_search = substring->utf16_view();
+        }
+    }
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -293,6 +305,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             //        the remaining string length from the current path. The value though
             //        has to be filled in reverse. That implies a second run over bytecode
             //        after generation has finished.
+            if (pure_substring_search.has_value()) {
+                auto position = input.view.u16_view().find_code_unit_offset(*pure_substring_search, view_index);
+                if (!position.has_value())
+                    break;
+                view_index = *position;
+            }
+
             auto const match_length_minimum = m_pattern->parser_result.match_length_minimum;
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
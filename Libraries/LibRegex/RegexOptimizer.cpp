@@ -827,7 +827,7 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
         return false;
 
     if (basic_blocks.is_empty()) {
-        parser_result.optimization_data.pure_substring_search = ""sv;
+        parser_result.optimization_data.pure_substring_search = Utf16String {};
         return true; // Empty regex, sure.
     }
 
@@ -836,7 +836,7 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
     auto is_unicode = parser_result.options.has_flag_set(AllFlags::Unicode) || parser_result.options.has_flag_set(AllFlags::UnicodeSets);
 
     // We have a single basic block, let's see if it's a series of character or string compares.
-    StringBuilder final_string;
+    StringBuilder final_string(StringBuilder::Mode::UTF16);
     auto state = MatchState::only_for_enumeration();
     while (state.instruction_position < bytecode.size()) {
         auto& opcode = bytecode.get_opcode(state);
@@ -847,10 +847,10 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
                 if (flat_compare.type != CharacterCompareType::Char)
                     return false;
 
-                if (is_unicode || flat_compare.value <= 0x7f)
+                if (is_unicode)
                     final_string.append_code_point(flat_compare.value);
                 else
-                    final_string.append(bit_cast<char>(static_cast<u8>(flat_compare.value)));
+                    final_string.append_code_unit(static_cast<char16_t>(flat_compare.value));
             }
             break;
         }
@@ -860,7 +860,7 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
         state.instruction_position += opcode.size();
     }
 
-    parser_result.optimization_data.pure_substring_search = final_string.to_byte_string();
+    parser_result.optimization_data.pure_substring_search = final_string.to_utf16_string();
     return true;
 }
 
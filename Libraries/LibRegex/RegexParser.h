@@ -63,7 +63,7 @@ public:
         AllOptions options;
 
         struct {
-            Optional<ByteString> pure_substring_search;
+            Optional<Utf16String> pure_substring_search;
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
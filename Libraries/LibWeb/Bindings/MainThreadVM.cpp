@@ -17,6 +17,7 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/ModuleRequest.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/PromiseJobs.h>
 #include <LibJS/Runtime/ShadowRealm.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/SourceTextModule.h>
@@ -93,6 +94,59 @@ static NonnullOwnPtr<JS::Agent> create_agent(GC::Heap& heap, AgentType type)
     VERIFY_NOT_REACHED();
 }
 
+// The steps of the microtask queued by HostEnqueuePromiseJob(job, realm), see host_enqueue_promise_job below.
+void run_promise_job(JS::VM& vm, JS::Realm* realm, JS::ScriptOrModule const& script_or_module, Function<JS::ThrowCompletionOr<JS::Value>()> const& job)
+{
+    // The dummy execution context has to be kept up here to keep it alive for the duration of the function.
+    OwnPtr<JS::ExecutionContext> dummy_execution_context;
+
+    if (realm) {
+        // 1. If realm is not null, then check if we can run script with realm. If this returns "do not run" then return.
+        if (HTML::can_run_script(*realm) == HTML::RunScriptDecision::DoNotRun)
+            return;
+
+        // 2. If realm is not null, then prepare to run script with realm.
+        HTML::prepare_to_run_script(*realm);
+
+        // IMPLEMENTATION DEFINED: Additionally to preparing to run a script, we also prepare to run a callback here. This matches WebIDL's
+        //                         invoke_callback() / call_user_object_operation() functions, and prevents a crash in host_make_job_callback()
+        //                         when getting the incumbent settings object.
+        HTML::prepare_to_run_callback(*realm);
+
+        // IMPLEMENTATION DEFINED: Per the previous "implementation defined" comment, we must now make the script or module the active script or module.
+        //                         Since the only active execution context currently is the realm execution context of job settings, lets attach it here.
+        HTML::execution_context_of_realm(*realm).script_or_module = script_or_module;
+    } else {
+        // FIXME: We need to setup a dummy execution context in case a JS::NativeFunction is called when processing the job.
+        //        This is because JS::NativeFunction::call excepts something to be on the execution context stack to be able to get the caller context to initialize the environment.
+        //        Do note that the JS spec gives _no_ guarantee that the execution context stack has something on it if HostEnqueuePromiseJob was called with a null realm: https://tc39.es/ecma262/#job-preparedtoevaluatecode
+        dummy_execution_context = JS::ExecutionContext::create(0, 0);
+        dummy_execution_context->script_or_module = script_or_module;
+        vm.push_execution_context(*dummy_execution_context);
+    }
+
+    // 3. Let result be job().
+    auto result = job();
+
+    // 4. If realm is not null, then clean up after running script with job settings.
+    if (realm) {
+        // IMPLEMENTATION DEFINED: Disassociate the realm execution context from the script or module.
+        HTML::execution_context_of_realm(*realm).script_or_module = Empty {};
+
+        // IMPLEMENTATION DEFINED: See comment above, we need to clean up the non-standard prepare_to_run_callback() call.
+        HTML::clean_up_after_running_callback(*realm);
+
+        HTML::clean_up_after_running_script(*realm);
+    } else {
+        // Pop off the dummy execution context. See the above FIXME block about why this is done.
+        vm.pop_execution_context();
+    }
+
+    // 5. If result is an abrupt completion, then report the exception given by result.[[Value]].
+    if (result.is_error())
+        HTML::report_exception(result, *realm);
+}
+
 void initialize_main_thread_vm(AgentType type)
 {
     VERIFY(!s_main_thread_vm);
@@ -290,55 +344,23 @@ void initialize_main_thread_vm(AgentType type)
 
         auto& heap = realm ? realm->heap() : vm.heap();
         HTML::queue_a_microtask(script ? script->settings_object().responsible_document().ptr() : nullptr, GC::create_function(heap, [&vm, realm, job = move(job), script_or_module = move(script_or_module)] {
-            // The dummy execution context has to be kept up here to keep it alive for the duration of the function.
-            OwnPtr<JS::ExecutionContext> dummy_execution_context;
-
-            if (realm) {
-                // 1. If realm is not null, then check if we can run script with realm. If this returns "do not run" then return.
-                if (HTML::can_run_script(*realm) == HTML::RunScriptDecision::DoNotRun)
-                    return;
-
-                // 2. If realm is not null, then prepare to run script with realm.
-                HTML::prepare_to_run_script(*realm);
-
-                // IMPLEMENTATION DEFINED: Additionally to preparing to run a script, we also prepare to run a callback here. This matches WebIDL's
-                //                         invoke_callback() / call_user_object_operation() functions, and prevents a crash in host_make_job_callback()
-                //                         when getting the incumbent settings object.
-                HTML::prepare_to_run_callback(*realm);
-
-                // IMPLEMENTATION DEFINED: Per the previous "implementation defined" comment, we must now make the script or module the active script or module.
-                //                         Since the only active execution context currently is the realm execution context of job settings, lets attach it here.
-                HTML::execution_context_of_realm(*realm).script_or_module = script_or_module;
-            } else {
-                // FIXME: We need to setup a dummy execution context in case a JS::NativeFunction is called when processing the job.
-                //        This is because JS::NativeFunction::call excepts something to be on the execution context stack to be able to get the caller context to initialize the environment.
-                //        Do note that the JS spec gives _no_ guarantee that the execution context stack has something on it if HostEnqueuePromiseJob was called with a null realm: https://tc39.es/ecma262/#job-preparedtoevaluatecode
-                dummy_execution_context = JS::ExecutionContext::create(0, 0);
-                dummy_execution_context->script_or_module = script_or_module;
-                vm.push_execution_context(*dummy_execution_context);
-            }
-
-            // 3. Let result be job().
-            auto result = job->function()();
-
-            // 4. If realm is not null, then clean up after running script with job settings.
-            if (realm) {
-                // IMPLEMENTATION DEFINED: Disassociate the realm execution context from the script or module.
-                HTML::execution_context_of_realm(*realm).script_or_module = Empty {};
-
-                // IMPLEMENTATION DEFINED: See comment above, we need to clean up the non-standard prepare_to_run_callback() call.
-                HTML::clean_up_after_running_callback(*realm);
+            run_promise_job(vm, realm, script_or_module, [&] { return job->function()(); });
+        }));
+    };
 
-                HTML::clean_up_after_running_script(*realm);
-            } else {
-                // Pop off the dummy execution context. See the above FIXME block about why this is done.
-                vm.pop_execution_context();
-            }
+    // NewPromiseReactionJob(reaction, argument) followed by HostEnqueuePromiseJob(job, realm).
+    // OPTIMIZATION: Promise reactions are by far the most common promise jobs. Rather than allocating a job closure and
+    //               a microtask closure for each of them, the reaction and its argument are stored in the microtask,
+    //               which runs the job's steps directly.
+    s_main_thread_vm->host_enqueue_promise_reaction_job = [](JS::PromiseReaction& reaction, JS::Value argument) {
+        auto& vm = *s_main_thread_vm;
+        auto* realm = JS::promise_reaction_job_realm(vm, reaction);
 
-            // 5. If result is an abrupt completion, then report the exception given by result.[[Value]].
-            if (result.is_error())
-                HTML::report_exception(result, *realm);
-        }));
+        // NOTE: See host_enqueue_promise_job above for these steps.
+        auto script_or_module = vm.get_active_script_or_module();
+        auto* script = active_script();
+        HTML::queue_a_promise_reaction_microtask(script ? script->settings_object().responsible_document().ptr() : nullptr,
+            { .reaction = reaction, .argument = argument, .realm = realm, .script_or_module = move(script_or_module) });
     };
 
     // 8.1.5.4.4 HostMakeJobCallback(callable), https://html.spec.whatwg.org/multipage/webappapis.html#hostmakejobcallback
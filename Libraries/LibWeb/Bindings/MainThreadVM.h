@@ -38,6 +38,7 @@ WEB_API void initialize_main_thread_vm(AgentType);
 WEB_API JS::VM& main_thread_vm();
 
 void queue_mutation_observer_microtask(DOM::Document const&);
+void run_promise_job(JS::VM&, JS::Realm*, JS::ScriptOrModule const&, Function<JS::ThrowCompletionOr<JS::Value>()> const& job);
 WEB_API NonnullOwnPtr<JS::ExecutionContext> create_a_new_javascript_realm(JS::VM&, Function<JS::Object*(JS::Realm&)> create_global_object, Function<JS::Object*(JS::Realm&)> create_global_this_value);
 WEB_API void invoke_custom_element_reactions(Vector<GC::Root<DOM::Element>>& element_queue);
 
@@ -173,13 +173,8 @@ Optional<StyleProperty const&> CSSStyleProperties::custom_property(FlyString con
 
         element.document().update_style();
 
-        auto const* element_to_check = &element;
-        while (element_to_check) {
-            if (auto property = element_to_check->custom_properties(pseudo_element).get(custom_property_name); property.has_value())
-                return *property;
-
-            element_to_check = element_to_check->parent_element();
-        }
+        if (auto custom_property_data = element.custom_property_data(pseudo_element))
+            return custom_property_data->get(custom_property_name);
 
         return {};
     }
@@ -48,6 +48,65 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
+ComputedProperties::PropertyGroupSlot ComputedProperties::property_group_slot(PropertyID property_id)
+{
+    static auto const slots = [] {
+        Array<PropertyGroupSlot, number_of_longhand_properties> slots {};
+
+        // Inherited properties go into the first groups and non-inherited ones into the rest, since inherited values
+        // are usually the same as the parent's and non-inherited ones the same as the initial values.
+        size_t inherited_count = 0;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            if (is_inherited_property(static_cast<PropertyID>(i)))
+                ++inherited_count;
+        }
+
+        size_t next_inherited_slot = 0;
+        size_t next_non_inherited_slot = align_up_to(inherited_count, property_group_size);
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto& slot = is_inherited_property(static_cast<PropertyID>(i)) ? next_inherited_slot : next_non_inherited_slot;
+            slots[i - to_underlying(first_longhand_property_id)] = {
+                static_cast<u8>(slot / property_group_size),
+                static_cast<u8>(slot % property_group_size),
+            };
+            ++slot;
+        }
+        VERIFY(next_non_inherited_slot <= property_group_count * property_group_size);
+        return slots;
+    }();
+    return slots[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+}
+
+bool ComputedProperties::PropertyGroup::has_same_values_as(PropertyGroup const& other) const
+{
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto const& value = values[i];
+        auto const& other_value = other.values[i];
+        if (value == other_value)
+            continue;
+        if (!value || !other_value || !value->equals(*other_value))
+            return false;
+    }
+    return true;
+}
+
+Array<RefPtr<ComputedProperties::PropertyGroup>, ComputedProperties::property_group_count> const& ComputedProperties::initial_property_groups()
+{
+    static auto const groups = [] {
+        Array<RefPtr<PropertyGroup>, property_group_count> groups;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            auto slot = property_group_slot(property_id);
+            auto& group = groups[slot.group];
+            if (!group)
+                group = make_ref_counted<PropertyGroup>();
+            group->values[slot.index] = property_initial_value(property_id);
+        }
+        return groups;
+    }();
+    return groups;
+}
+
 ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
@@ -146,14 +205,18 @@ void ComputedProperties::set_property_without_modifying_flags(PropertyID id, Non
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = move(value);
+    // NOTE: Don't unshare the group if the value doesn't actually change.
+    if (property_value_or_null(id) == value.ptr())
+        return;
+    ensure_unshared_property_value(id) = move(value);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = style_for_revert.m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    if (auto const* value = style_for_revert.property_value_or_null(id); value != property_value_or_null(id))
+        ensure_unshared_property_value(id) = value;
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -199,7 +262,48 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+    return *property_value_or_null(property_id);
+}
+
+StyleValue const* ComputedProperties::property_value_or_null(PropertyID property_id) const
+{
+    auto slot = property_group_slot(property_id);
+    auto const& group = m_property_groups[slot.group];
+    if (!group)
+        return nullptr;
+    return group->values[slot.index].ptr();
+}
+
+RefPtr<StyleValue const>& ComputedProperties::ensure_unshared_property_value(PropertyID property_id)
+{
+    auto slot = property_group_slot(property_id);
+    auto& group = m_property_groups[slot.group];
+    if (!group) {
+        group = make_ref_counted<PropertyGroup>();
+    } else if (group->ref_count() > 1) {
+        auto copy = make_ref_counted<PropertyGroup>();
+        copy->values = group->values;
+        group = move(copy);
+    }
+    return group->values[slot.index];
+}
+
+void ComputedProperties::share_property_groups(ComputedProperties const* parent_style)
+{
+    auto const& initial_groups = initial_property_groups();
+    for (size_t i = 0; i < m_property_groups.size(); ++i) {
+        auto& group = m_property_groups[i];
+        if (!group)
+            continue;
+        if (parent_style) {
+            if (auto const& parent_group = parent_style->m_property_groups[i]; parent_group && (parent_group == group || parent_group->has_same_values_as(*group))) {
+                group = parent_group;
+                continue;
+            }
+        }
+        if (auto const& initial_group = initial_groups[i]; initial_group && initial_group->has_same_values_as(*group))
+            group = initial_group;
+    }
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -887,21 +991,16 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
-        if (!my_style) {
-            if (other_style)
-                return false;
+    for (size_t i = 0; i < m_property_groups.size(); ++i) {
+        auto const& my_group = m_property_groups[i];
+        auto const& other_group = other.m_property_groups[i];
+
+        // OPTIMIZATION: Shared groups are equal without having to compare their values.
+        if (my_group == other_group)
             continue;
-        }
-        if (!other_style)
-            return false;
-        auto const& my_value = *my_style;
-        auto const& other_value = *other_style;
-        if (my_value.type() != other_value.type())
+        if (!my_group || !other_group)
             return false;
-        if (my_value != other_value)
+        if (!my_group->has_same_values_as(*other_group))
             return false;
     }
 
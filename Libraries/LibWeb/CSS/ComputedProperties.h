@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -43,9 +44,10 @@ public:
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback(static_cast<PropertyID>(i + to_underlying(first_longhand_property_id)), *m_property_values[i]);
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            if (auto const* value = property_value_or_null(property_id))
+                callback(property_id, *value);
         }
     }
 
@@ -77,6 +79,9 @@ public:
     StyleValue const& property(PropertyID, WithAnimationsApplied = WithAnimationsApplied::Yes) const;
     void revert_property(PropertyID, ComputedProperties const& style_for_revert);
 
+    // Replaces groups of values with the parent's or the initial ones where they're equal, so that they're only stored once.
+    void share_property_groups(ComputedProperties const* parent_style);
+
     Size size_value(PropertyID) const;
     [[nodiscard]] Variant<LengthPercentage, NormalGap> gap_value(PropertyID) const;
     Length length(PropertyID) const;
@@ -295,7 +300,30 @@ private:
     Vector<ShadowData> shadow(PropertyID, Layout::Node const&) const;
     Position position_value(PropertyID) const;
 
-    Array<RefPtr<StyleValue const>, number_of_longhand_properties> m_property_values;
+    // The computed values are stored in fixed-size groups of properties, each of which holds either only inherited or
+    // only non-inherited properties. Groups are shared with the parent's style or with the initial values whenever all
+    // of their values are the same, and copied before being modified if they are shared.
+    static constexpr size_t property_group_size = 32;
+    static constexpr size_t property_group_count = ceil_div(number_of_longhand_properties, property_group_size) + 1;
+
+    struct PropertyGroup final : public RefCounted<PropertyGroup> {
+        bool has_same_values_as(PropertyGroup const&) const;
+
+        Array<RefPtr<StyleValue const>, property_group_size> values;
+    };
+
+    struct PropertyGroupSlot {
+        u8 group;
+        u8 index;
+    };
+
+    static PropertyGroupSlot property_group_slot(PropertyID);
+    static Array<RefPtr<PropertyGroup>, property_group_count> const& initial_property_groups();
+
+    StyleValue const* property_value_or_null(PropertyID) const;
+    RefPtr<StyleValue const>& ensure_unshared_property_value(PropertyID);
+
+    Array<RefPtr<PropertyGroup>, property_group_count> m_property_groups;
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_inherited {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_animated_property_inherited {};
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/CSS/CustomPropertyData.h>
+#include <LibWeb/CSS/StyleValues/StyleValue.h>
+
+namespace Web::CSS {
+
+// The longest chain that a lookup may have to walk. Beyond this, a child links to a flattened copy of the chain
+// instead, so that lookups stay fast in deeply nested documents where many elements declare custom properties.
+static constexpr size_t MAX_ANCESTOR_COUNT = 8;
+
+RefPtr<CustomPropertyData const> CustomPropertyData::create(OrderedHashMap<FlyString, StyleProperty> const& own_values, RefPtr<CustomPropertyData const> parent)
+{
+    if (own_values.is_empty())
+        return parent;
+
+    if (parent && parent->m_ancestor_count >= MAX_ANCESTOR_COUNT)
+        parent = parent->flattened();
+
+    return adopt_ref(*new CustomPropertyData(own_values, move(parent)));
+}
+
+CustomPropertyData::CustomPropertyData(OrderedHashMap<FlyString, StyleProperty> own_values, RefPtr<CustomPropertyData const> parent)
+    : m_own_values(move(own_values))
+    , m_parent(move(parent))
+    , m_ancestor_count(m_parent ? m_parent->m_ancestor_count + 1 : 0)
+{
+}
+
+Optional<StyleProperty const&> CustomPropertyData::get(FlyString const& name) const
+{
+    for (auto const* data = this; data; data = data->m_parent.ptr()) {
+        if (auto it = data->m_own_values.find(name); it != data->m_own_values.end())
+            return it->value;
+    }
+    return {};
+}
+
+NonnullRefPtr<CustomPropertyData const> CustomPropertyData::flattened() const
+{
+    if (m_flattened)
+        return *m_flattened;
+
+    OrderedHashMap<FlyString, StyleProperty> values;
+    for (auto const* data = this; data; data = data->m_parent.ptr()) {
+        for (auto const& [name, property] : data->m_own_values)
+            values.ensure(name, [&] { return property; });
+    }
+
+    m_flattened = adopt_ref(*new CustomPropertyData(move(values), nullptr));
+    return *m_flattened;
+}
+
+}
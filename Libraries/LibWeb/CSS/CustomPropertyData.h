@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <LibWeb/CSS/StyleProperty.h>
+
+namespace Web::CSS {
+
+// All the custom properties that apply to an element, including the ones it inherits.
+//
+// This is a chain of immutable maps: each element's data only holds the custom properties declared on that element,
+// and links to the data it inherits everything else from. Elements that don't declare any custom properties share
+// the data of the element they inherit from, so that variables defined on the root element aren't copied into every
+// element. Looking a property up walks the chain, which is kept short by flattening it once it gets too long.
+class CustomPropertyData : public RefCounted<CustomPropertyData> {
+public:
+    // Returns the data for an element that declares the given custom properties and inherits the rest from parent.
+    // If the element doesn't declare any, this is the parent itself.
+    static RefPtr<CustomPropertyData const> create(OrderedHashMap<FlyString, StyleProperty> const& own_values, RefPtr<CustomPropertyData const> parent);
+
+    Optional<StyleProperty const&> get(FlyString const& name) const;
+
+private:
+    CustomPropertyData(OrderedHashMap<FlyString, StyleProperty> own_values, RefPtr<CustomPropertyData const> parent);
+
+    NonnullRefPtr<CustomPropertyData const> flattened() const;
+
+    OrderedHashMap<FlyString, StyleProperty> m_own_values;
+    RefPtr<CustomPropertyData const> m_parent;
+    // The number of links in the chain above this one.
+    size_t m_ancestor_count { 0 };
+
+    // A copy of this chain merged into a single map, shared by the children that would otherwise make it too long.
+    mutable RefPtr<CustomPropertyData const> m_flattened;
+};
+
+}
@@ -5,7 +5,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/Debug.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <AK/StringConversions.h>
 #include <AK/Vector.h>
@@ -155,6 +158,74 @@ static inline bool is_E(u32 code_point)
     return code_point == 0x45;
 }
 
+// The fast paths below work directly on the UTF-8 bytes of the input, a vector of bytes at a time, for as long as
+// those bytes are ASCII. Anything else is left to the code point based algorithms from the spec.
+using AK::SIMD::u64x2;
+using AK::SIMD::u8x16;
+
+static constexpr size_t BYTES_PER_VECTOR = AK::SIMD::vector_length<u8x16>;
+
+// Returns how many of the mask's bytes are set before the first one that isn't.
+template<typename Mask>
+static ALWAYS_INLINE size_t count_leading_set_bytes(Mask mask)
+{
+    // NOTE: This assumes a little-endian target, where the first byte ends up in the lowest bits of the first word.
+    auto unset_bytes = bit_cast<u64x2>(~mask);
+    if (unset_bytes[0] != 0)
+        return count_trailing_zeroes(unset_bytes[0]) / 8;
+    if (unset_bytes[1] != 0)
+        return 8 + (count_trailing_zeroes(unset_bytes[1]) / 8);
+    return BYTES_PER_VECTOR;
+}
+
+// Returns the length of the longest prefix of the bytes that matches the predicates. These must only match ASCII bytes
+// other than newlines, so that each byte in the prefix is one code point, and all of them are on the same line.
+template<typename VectorPredicate, typename BytePredicate>
+static ALWAYS_INLINE size_t length_of_ascii_run(ReadonlyBytes bytes, VectorPredicate matches_vector, BytePredicate matches_byte)
+{
+    size_t length = 0;
+    while (length + BYTES_PER_VECTOR <= bytes.size()) {
+        auto matching_count = count_leading_set_bytes(matches_vector(AK::SIMD::load_unaligned<u8x16>(&bytes[length])));
+        length += matching_count;
+        if (matching_count != BYTES_PER_VECTOR)
+            return length;
+    }
+    while (length < bytes.size() && matches_byte(bytes[length]))
+        ++length;
+    return length;
+}
+
+static ALWAYS_INLINE auto ascii_ident_code_point_mask(u8x16 bytes)
+{
+    auto lowercase = bytes | 0x20;
+    return ((lowercase >= 'a') & (lowercase <= 'z')) | ((bytes >= '0') & (bytes <= '9')) | (bytes == '_') | (bytes == '-');
+}
+
+static ALWAYS_INLINE bool is_ascii_ident_code_point(u8 byte)
+{
+    return is_ascii(byte) && is_ident_code_point(byte);
+}
+
+static ALWAYS_INLINE auto ascii_digit_mask(u8x16 bytes)
+{
+    return (bytes >= '0') & (bytes <= '9');
+}
+
+static ALWAYS_INLINE bool is_ascii_digit_byte(u8 byte)
+{
+    return is_digit(byte);
+}
+
+static ALWAYS_INLINE auto space_or_tab_mask(u8x16 bytes)
+{
+    return (bytes == ' ') | (bytes == '\t');
+}
+
+static ALWAYS_INLINE bool is_space_or_tab(u8 byte)
+{
+    return byte == ' ' || byte == '\t';
+}
+
 Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
 {
     // https://www.w3.org/TR/css-syntax-3/#css-filter-code-points
@@ -438,46 +509,40 @@ Number Tokenizer::consume_a_number()
     // Execute the following steps in order:
 
     // 1. Initially set type to "integer". Let repr be the empty string.
-    StringBuilder repr;
+    // OPTIMIZATION: Everything this consumes is ASCII and appended to repr, so repr is simply the consumed part of the
+    //               input. Take it from there at the end, instead of building it up one code point at a time.
+    auto repr_start_byte_offset = current_byte_offset();
     Number::Type type = Number::Type::Integer;
 
+    auto consume_digits = [&] {
+        consume_ascii_bytes(length_of_ascii_run(remaining_input_bytes(), ascii_digit_mask, is_ascii_digit_byte));
+    };
+
     // 2. If the next input code point is U+002B PLUS SIGN (+) or U+002D HYPHEN-MINUS (-),
     // consume it and append it to repr.
     bool has_explicit_sign = false;
     auto next_input = peek_code_point();
     if (is_plus_sign(next_input) || is_hyphen_minus(next_input)) {
         has_explicit_sign = true;
-        repr.append_code_point(next_code_point());
+        (void)next_code_point();
     }
 
     // 3. While the next input code point is a digit, consume it and append it to repr.
-    for (;;) {
-        auto digits = peek_code_point();
-        if (!is_digit(digits))
-            break;
-
-        repr.append_code_point(next_code_point());
-    }
+    consume_digits();
 
     // 4. If the next 2 input code points are U+002E FULL STOP (.) followed by a digit, then:
     auto maybe_number = peek_twin();
     if (is_full_stop(maybe_number.first) && is_digit(maybe_number.second)) {
         // 1. Consume them.
         // 2. Append them to repr.
-        repr.append_code_point(next_code_point());
-        repr.append_code_point(next_code_point());
+        (void)next_code_point();
+        (void)next_code_point();
 
         // 3. Set type to "number".
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digit = peek_code_point();
-            if (!is_digit(digit))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        consume_digits();
     }
 
     // 5. If the next 2 or 3 input code points are U+0045 LATIN CAPITAL LETTER E (E) or
@@ -491,30 +556,25 @@ Number Tokenizer::consume_a_number()
         // 2. Append them to repr.
         if (is_plus_sign(maybe_exp.second) || is_hyphen_minus(maybe_exp.second)) {
             if (is_digit(maybe_exp.third)) {
-                repr.append_code_point(next_code_point());
-                repr.append_code_point(next_code_point());
-                repr.append_code_point(next_code_point());
+                (void)next_code_point();
+                (void)next_code_point();
+                (void)next_code_point();
             }
         } else if (is_digit(maybe_exp.second)) {
-            repr.append_code_point(next_code_point());
-            repr.append_code_point(next_code_point());
+            (void)next_code_point();
+            (void)next_code_point();
         }
 
         // 3. Set type to "number".
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digits = peek_code_point();
-            if (!is_digit(digits))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        consume_digits();
     }
 
     // 6. Convert repr to a number, and set the value to the returned value.
-    auto value = convert_a_string_to_a_number(repr.string_view());
+    auto repr = StringView { m_utf8_view.bytes() + repr_start_byte_offset, current_byte_offset() - repr_start_byte_offset };
+    auto value = convert_a_string_to_a_number(repr);
 
     // 7. Return value and type.
     if (type == Number::Type::Integer && has_explicit_sign)
@@ -542,8 +602,18 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    // OPTIMIZATION: Most ident sequences are plain ASCII without any escapes. Take those straight from the input,
+    //               instead of building them up one code point at a time.
+    auto remaining_bytes = remaining_input_bytes();
+    auto ascii_length = length_of_ascii_run(remaining_bytes, ascii_ident_code_point_mask, is_ascii_ident_code_point);
+    auto ascii_prefix = remaining_bytes.trim(ascii_length);
+    consume_ascii_bytes(ascii_length);
+    if (ascii_length == remaining_bytes.size() || (is_ascii(remaining_bytes[ascii_length]) && !is_reverse_solidus(remaining_bytes[ascii_length])))
+        return FlyString::from_utf8_without_validation(ascii_prefix);
+
     // Let result initially be an empty string.
     StringBuilder result;
+    result.append(StringView { ascii_prefix });
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -703,7 +773,12 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
+    // OPTIMIZATION: Skip runs of spaces and tabs a vector at a time, and only consume newlines one by one, since they
+    //               move the position to the next line.
+    for (;;) {
+        consume_ascii_bytes(length_of_ascii_run(remaining_input_bytes(), space_or_tab_mask, is_space_or_tab));
+        if (!is_whitespace(peek_code_point()))
+            return;
         (void)next_code_point();
     }
 }
@@ -875,8 +950,29 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
     auto original_source_text_start_byte_offset_including_quotation_mark = current_byte_offset() - 1;
     StringBuilder builder;
 
+    auto const ending_byte = static_cast<u8>(ending_code_point);
+    auto plain_string_byte_mask = [ending_byte](u8x16 bytes) {
+        return (bytes != ending_byte) & (bytes != '\\') & (bytes != '\n') & (bytes < 0x80);
+    };
+    auto is_plain_string_byte = [ending_byte](u8 byte) {
+        return byte != ending_byte && !is_reverse_solidus(byte) && !is_newline(byte) && is_ascii(byte);
+    };
+
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Everything up to the next ending code point, escape or newline is appended as-is, so append
+        //               runs of such ASCII bytes all at once. If that's the whole string, don't copy it at all.
+        auto remaining_bytes = remaining_input_bytes();
+        if (auto plain_length = length_of_ascii_run(remaining_bytes, plain_string_byte_mask, is_plain_string_byte); plain_length > 0) {
+            auto plain_bytes = remaining_bytes.trim(plain_length);
+            consume_ascii_bytes(plain_length);
+            if (builder.is_empty() && plain_length < remaining_bytes.size() && remaining_bytes[plain_length] == ending_byte) {
+                (void)next_code_point();
+                return Token::create_string(FlyString::from_utf8_without_validation(plain_bytes), input_since(original_source_text_start_byte_offset_including_quotation_mark));
+            }
+            builder.append(StringView { plain_bytes });
+        }
+
         auto input = next_code_point();
 
         // ending code point
@@ -946,6 +1042,15 @@ start:
     (void)next_code_point();
 
     for (;;) {
+        // OPTIMIZATION: Skip everything that can't end the comment a vector at a time. The last code point of the input
+        //               is left alone, since it's not consumed if the comment is unterminated.
+        if (auto remaining_bytes = remaining_input_bytes(); !remaining_bytes.is_empty()) {
+            consume_ascii_bytes(length_of_ascii_run(
+                remaining_bytes.trim(remaining_bytes.size() - 1),
+                [](u8x16 bytes) { return (bytes != '*') & (bytes != '\n') & (bytes < 0x80); },
+                [](u8 byte) { return !is_asterisk(byte) && !is_newline(byte) && is_ascii(byte); }));
+        }
+
         auto twin_inner = peek_twin();
         if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
             log_parse_error();
@@ -1238,4 +1343,22 @@ String Tokenizer::input_since(size_t offset) const
     return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
 }
 
+ReadonlyBytes Tokenizer::remaining_input_bytes() const
+{
+    return { m_utf8_iterator.ptr(), m_utf8_view.byte_length() - current_byte_offset() };
+}
+
+// Consumes the given number of bytes, which must all be ASCII code points other than newlines.
+void Tokenizer::consume_ascii_bytes(size_t count)
+{
+    if (count == 0)
+        return;
+
+    auto byte_offset = current_byte_offset() + count;
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(byte_offset - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(byte_offset);
+    m_prev_position = { m_position.line, m_position.column + count - 1 };
+    m_position.column += count;
+}
+
 }
@@ -72,6 +72,9 @@ private:
     size_t current_byte_offset() const;
     String input_since(size_t offset) const;
 
+    ReadonlyBytes remaining_input_bytes() const;
+    void consume_ascii_bytes(size_t count);
+
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
     [[nodiscard]] U32Twin peek_twin() const;
@@ -211,7 +211,24 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
 // https://drafts.csswg.org/selectors-4/#relational
 static inline bool matches_has_pseudo_class(CSS::Selector const& selector, DOM::Element const& anchor, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    if (!context.has_match_cache)
+        return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+
+    // OPTIMIZATION: Selectors like ".a:has(.b) .c" match the same :has() against the same anchor for every candidate
+    //               subject, which means traversing the anchor's whole subtree each time. Remember the result instead.
+    HasMatchCacheKey key { &selector, &anchor, shadow_host.ptr() };
+    if (auto cached = context.has_match_cache->get(key); cached.has_value()) {
+        context.attempted_pseudo_class_matches |= cached->attempted_pseudo_class_matches;
+        if (context.collect_per_element_selector_involvement_metadata && selector.sibling_invalidation_distance() > 0)
+            const_cast<DOM::Element&>(anchor).set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(true);
+        return cached->matches;
+    }
+
+    auto attempted_pseudo_class_matches = exchange(context.attempted_pseudo_class_matches, {});
+    auto result = matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    context.has_match_cache->set(key, { result, context.attempted_pseudo_class_matches });
+    context.attempted_pseudo_class_matches |= attempted_pseudo_class_matches;
+    return result;
 }
 
 static bool matches_hover_pseudo_class(DOM::Element const& element)
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/DOM/Element.h>
 
@@ -16,12 +17,37 @@ enum class SelectorKind {
     Relative,
 };
 
+struct HasMatchCacheKey {
+    CSS::Selector const* relative_selector { nullptr };
+    DOM::Element const* anchor { nullptr };
+    DOM::Element const* shadow_host { nullptr };
+
+    bool operator==(HasMatchCacheKey const&) const = default;
+};
+
+struct HasMatchCacheKeyTraits : public DefaultTraits<HasMatchCacheKey> {
+    static unsigned hash(HasMatchCacheKey const& key)
+    {
+        return pair_int_hash(ptr_hash(key.relative_selector), pair_int_hash(ptr_hash(key.anchor), ptr_hash(key.shadow_host)));
+    }
+};
+
+struct HasMatchCacheEntry {
+    bool matches { false };
+    CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+};
+
+// The results of matching :has() arguments against their anchor elements. This is only valid for as long as the DOM
+// and the state of elements don't change, e.g. during a single style update.
+using HasMatchCache = HashMap<HasMatchCacheKey, HasMatchCacheEntry, HasMatchCacheKeyTraits>;
+
 struct MatchContext {
     GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule {};
     GC::Ptr<DOM::Element const> subject {};
     GC::Ptr<DOM::Element const> slotted_element {}; // Only set when matching a ::slotted() pseudo-element
     bool collect_per_element_selector_involvement_metadata { false };
     CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    HasMatchCache* has_match_cache { nullptr };
 };
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
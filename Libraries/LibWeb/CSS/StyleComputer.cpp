@@ -554,6 +554,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
             .style_sheet_for_rule = *rule_to_run.sheet,
             .subject = abstract_element.element(),
             .collect_per_element_selector_involvement_metadata = true,
+            .has_match_cache = m_has_match_cache.has_value() ? &m_has_match_cache.value() : nullptr,
         };
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
@@ -1349,10 +1350,10 @@ void StyleComputer::start_needed_transitions(ComputedProperties const& previous_
             // - there is a matching transition-property value, and
             // NOTE: We only iterate over properties for which this is true
             // - the before-change style is different from the after-change style for that property, and the values for the property are transitionable,
-            (!before_change_value.equals(after_change_value) && property_values_are_transitionable(property_id, before_change_value, after_change_value, element, matching_transition_properties.transition_behavior)) &&
+            (before_change_value != after_change_value && property_values_are_transitionable(property_id, before_change_value, after_change_value, element, matching_transition_properties.transition_behavior)) &&
             // - the element does not have a completed transition for the property
             //   or the end value of the completed transition is different from the after-change style for the property,
-            (!has_completed_transition || !existing_transition->transition_end_value()->equals(after_change_value)) &&
+            (!has_completed_transition || *existing_transition->transition_end_value() != after_change_value) &&
             // - the combined duration is greater than 0s,
             (combined_duration(matching_transition_properties) > 0)) {
 
@@ -1406,7 +1407,7 @@ void StyleComputer::start_needed_transitions(ComputedProperties const& previous_
             //    or if these two values are not transitionable,
             //    then implementations must cancel the running transition.
             auto& current_value = new_style.property(property_id, ComputedProperties::WithAnimationsApplied::Yes);
-            if (current_value.equals(after_change_value) || !property_values_are_transitionable(property_id, current_value, after_change_value, element, matching_transition_properties.transition_behavior)) {
+            if (current_value == after_change_value || !property_values_are_transitionable(property_id, current_value, after_change_value, element, matching_transition_properties.transition_behavior)) {
                 dbgln_if(CSS_TRANSITIONS_DEBUG, "Transition step 4.1");
                 existing_transition->cancel();
             }
@@ -1947,7 +1948,13 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
     // the requested code point, there is still a font available to provide a fallback glyph.
     font_list->set_last_resort_font(*default_font);
 
-    return font_list;
+    // OPTIMIZATION: Reuse an identical list computed for another element if there is one, so that the fallback fonts
+    //               for code points missing from the primary font are searched for once per document, not per element.
+    NonnullRefPtr<Gfx::FontCascadeList const> computed_font_list = move(font_list);
+    if (auto it = m_computed_font_lists.find(computed_font_list); it != m_computed_font_lists.end())
+        return *it;
+    m_computed_font_lists.set(computed_font_list);
+    return computed_font_list;
 }
 
 void StyleComputer::compute_font(ComputedProperties& style, Optional<DOM::AbstractElement> abstract_element) const
@@ -2361,6 +2368,9 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
         auto style = compute_style(abstract_element_for_pseudo_element);
 
+        // Link to the custom properties of the pseudo-element, for this element's descendants to inherit them.
+        element.set_custom_properties({}, {});
+
         // Merge back inline styles
         if (auto inline_style = element.inline_style()) {
             for (auto const& property : inline_style->properties())
@@ -2616,6 +2626,12 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::AbstractEleme
         start_needed_transitions(*previous_style, computed_style, abstract_element);
     }
 
+    // 10. Share unchanged groups of computed values with the parent's style or the initial values to save memory.
+    GC::Ptr<ComputedProperties const> parent_style;
+    if (auto parent_element = abstract_element.element_to_inherit_style_from(); parent_element.has_value())
+        parent_style = parent_element->computed_properties();
+    computed_style->share_property_groups(parent_style.ptr());
+
     return computed_style;
 }
 
@@ -2658,6 +2674,7 @@ static Optional<SimplifiedSelectorForBucketing> is_roundabout_selector_bucketabl
 void StyleComputer::did_load_font(FlyString const&)
 {
     m_font_matching_algorithm_cache = {};
+    m_computed_font_lists = {};
     document().invalidate_style(DOM::StyleInvalidationReason::CSSFontLoaded);
 }
 
@@ -3437,6 +3454,14 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter->clear();
 }
 
+void StyleComputer::set_has_match_cache_enabled(bool enabled)
+{
+    if (enabled)
+        m_has_match_cache = SelectorEngine::HasMatchCache {};
+    else
+        m_has_match_cache.clear();
+}
+
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
@@ -19,6 +19,7 @@
 #include <LibWeb/CSS/CascadeOrigin.h>
 #include <LibWeb/CSS/CascadedProperties.h>
 #include <LibWeb/CSS/Selector.h>
+#include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
 #include <LibWeb/CSS/StyleScope.h>
 #include <LibWeb/Export.h>
@@ -101,6 +102,11 @@ struct FontMatchingAlgorithmCacheKey {
     [[nodiscard]] bool operator==(FontMatchingAlgorithmCacheKey const& other) const = default;
 };
 
+struct ComputedFontListTraits : public DefaultTraits<NonnullRefPtr<Gfx::FontCascadeList const>> {
+    static unsigned hash(NonnullRefPtr<Gfx::FontCascadeList const> const& font_list) { return font_list->hash(); }
+    static bool equals(NonnullRefPtr<Gfx::FontCascadeList const> const& a, NonnullRefPtr<Gfx::FontCascadeList const> const& b) { return a->is_identical_to(*b); }
+};
+
 class FontLoader;
 
 class WEB_API StyleComputer final : public GC::Cell {
@@ -128,6 +134,10 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    // While enabled, the results of matching :has() are cached. This must only be enabled while neither the DOM nor
+    // the state of any element can change, i.e. during a style update.
+    void set_has_match_cache_enabled(bool);
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::AbstractElement, Optional<bool&> did_change_custom_properties = {}) const;
@@ -246,7 +256,13 @@ private:
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
 
+    mutable Optional<SelectorEngine::HasMatchCache> m_has_match_cache;
+
     mutable HashMap<FontMatchingAlgorithmCacheKey, RefPtr<Gfx::FontCascadeList const>> m_font_matching_algorithm_cache;
+
+    // Every font list computed for this document, so that elements with the same fonts share a single list, and with
+    // it the list's cache of fallback fonts.
+    mutable HashTable<NonnullRefPtr<Gfx::FontCascadeList const>, ComputedFontListTraits> m_computed_font_lists;
 };
 
 class FontLoader final : public GC::Cell {
@@ -79,10 +79,27 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
             if (in_has)
                 style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
             break;
+        case PseudoClass::FirstChild:
+        case PseudoClass::OnlyChild:
+        case PseudoClass::FirstOfType:
+        case PseudoClass::OnlyOfType:
+        case PseudoClass::NthChild:
+        case PseudoClass::NthOfType:
+        case PseudoClass::LastChild:
+        case PseudoClass::LastOfType:
+        case PseudoClass::NthLastChild:
+        case PseudoClass::NthLastOfType:
+            if (in_has)
+                style_invalidation_data.has_selectors_depend_on_any_sibling = true;
+            break;
         default:
             break;
         }
         for (auto const& child_selector : pseudo_class.argument_selector_list) {
+            if (in_has && child_selector->sibling_invalidation_distance() > 0)
+                style_invalidation_data.has_selectors_depend_on_any_sibling = true;
+            if (pseudo_class.type == PseudoClass::Has)
+                style_invalidation_data.sibling_invalidation_distance_of_has_selectors = max(style_invalidation_data.sibling_invalidation_distance_of_has_selectors, child_selector->sibling_invalidation_distance());
             for (auto const& compound_selector : child_selector->compound_selectors()) {
                 for (auto const& simple_selector : compound_selector.simple_selectors) {
                     collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has || pseudo_class.type == PseudoClass::Has);
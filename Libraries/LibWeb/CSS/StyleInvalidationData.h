@@ -20,6 +20,14 @@ struct StyleInvalidationData {
     HashTable<FlyString> tag_names_used_in_has_selectors;
     HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
 
+    // How many siblings back an element's :has() may look at a change, e.g. 1 for ":has(+ .a)", or the maximum size_t
+    // if any :has() argument contains the subsequent-sibling combinator.
+    size_t sibling_invalidation_distance_of_has_selectors { 0 };
+    // Whether any :has() argument depends on siblings other than the ones its own combinators lead to, e.g. through
+    // ":has(~ :nth-child(2))", ":has(+ :last-child)" or ":has(~ :is(.a + .b))". Then a change can affect :has() anchors
+    // anywhere among the changed element's siblings, not just the ones shortly before it.
+    bool has_selectors_depend_on_any_sibling { false };
+
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
 
@@ -413,27 +413,48 @@ void StyleScope::invalidate_style_of_elements_affected_by_has()
         return;
     }
 
+    auto sibling_invalidation_distance = m_style_invalidation_data->sibling_invalidation_distance_of_has_selectors;
+    auto has_selectors_depend_on_any_sibling = m_style_invalidation_data->has_selectors_depend_on_any_sibling;
+
+    // Pending nodes often share most of their ancestors, e.g. when many children of the same element change. Once an
+    // ancestor has been visited, all of its own ancestors have been visited as well.
+    HashTable<GC::Ptr<DOM::Node>> visited_ancestors;
+
     auto nodes = move(m_pending_nodes_for_style_invalidation_due_to_presence_of_has);
     for (auto const& node : nodes) {
         if (!node)
             continue;
         for (auto ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+            if (visited_ancestors.set(ancestor, AK::HashSetExistingEntryBehavior::Keep) == AK::HashSetResult::KeptExistingEntry)
+                break;
             if (!ancestor->is_element())
                 continue;
             auto& element = static_cast<DOM::Element&>(*ancestor);
             element.invalidate_style_if_affected_by_has();
 
-            auto* parent = ancestor->parent_or_shadow_host();
-            if (!parent)
-                return;
+            if (sibling_invalidation_distance == 0)
+                continue;
 
             // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
             // its style might be affected by the change in descendant node.
-            parent->for_each_child_of_type<DOM::Element>([&](auto& ancestor_sibling_element) {
-                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                    ancestor_sibling_element.invalidate_style_if_affected_by_has();
-                return IterationDecision::Continue;
-            });
+            if (has_selectors_depend_on_any_sibling) {
+                if (auto* parent = ancestor->parent_or_shadow_host()) {
+                    parent->for_each_child_of_type<DOM::Element>([&](auto& ancestor_sibling_element) {
+                        if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                            ancestor_sibling_element.invalidate_style_if_affected_by_has();
+                        return IterationDecision::Continue;
+                    });
+                }
+                continue;
+            }
+
+            // OPTIMIZATION: Otherwise, only preceding siblings can be affected, since these combinators only look
+            //               forward, and no further back than the longest chain of sibling combinators in a :has().
+            size_t distance = 0;
+            for (auto* sibling = element.previous_element_sibling(); sibling && distance < sibling_invalidation_distance; sibling = sibling->previous_element_sibling(), ++distance) {
+                if (sibling->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                    sibling->invalidate_style_if_affected_by_has();
+            }
         }
     }
 }
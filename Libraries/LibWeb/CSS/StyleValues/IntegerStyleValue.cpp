@@ -11,6 +11,19 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<IntegerStyleValue const> IntegerStyleValue::create(i64 value)
+{
+    // OPTIMIZATION: Small integers such as z-index or order values are shared, since they are immutable.
+    static Array<RefPtr<IntegerStyleValue const>, 16> small_integer_instances;
+    if (value >= 0 && static_cast<u64>(value) < small_integer_instances.size()) {
+        auto& instance = small_integer_instances[value];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) IntegerStyleValue(value));
+        return *instance;
+    }
+    return adopt_ref(*new (nothrow) IntegerStyleValue(value));
+}
+
 String IntegerStyleValue::to_string(SerializationMode) const
 {
     return String::number(m_value);
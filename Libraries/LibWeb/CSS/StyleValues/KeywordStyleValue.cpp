@@ -17,6 +17,16 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<KeywordStyleValue const> KeywordStyleValue::create(Keyword keyword)
+{
+    // OPTIMIZATION: Keyword values are immutable, so every keyword only ever needs a single instance.
+    static Array<RefPtr<KeywordStyleValue const>, number_of_keywords> instances;
+    auto& instance = instances[to_underlying(keyword)];
+    if (!instance)
+        instance = adopt_ref(*new (nothrow) KeywordStyleValue(keyword));
+    return *instance;
+}
+
 String KeywordStyleValue::to_string(SerializationMode) const
 {
     return MUST(String::from_utf8(string_from_keyword(keyword())));
@@ -8,20 +8,20 @@
  */
 
 #include "LengthStyleValue.h"
+#include <math.h>
 
 namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<LengthStyleValue const> LengthStyleValue::create(Length const& length)
 {
-    if (length.is_px()) {
-        if (length.raw_value() == 0) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(0)));
-            return value;
-        }
-        if (length.raw_value() == 1) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(1)));
-            return value;
-        }
+    // OPTIMIZATION: Small whole pixel lengths are by far the most common computed lengths, so they share one
+    //               instance per value.
+    static Array<RefPtr<LengthStyleValue const>, 65> small_px_instances;
+    if (auto raw_value = length.raw_value(); length.is_px() && raw_value >= 0 && raw_value < small_px_instances.size() && !signbit(raw_value) && trunc(raw_value) == raw_value) {
+        auto& instance = small_px_instances[static_cast<size_t>(raw_value)];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(raw_value)));
+        return *instance;
     }
     return adopt_ref(*new (nothrow) LengthStyleValue(length));
 }
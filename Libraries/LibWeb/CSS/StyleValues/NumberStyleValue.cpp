@@ -13,9 +13,24 @@
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/CSS/Serialize.h>
 #include <LibWeb/CSS/ValueType.h>
+#include <math.h>
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<NumberStyleValue const> NumberStyleValue::create(double value)
+{
+    // OPTIMIZATION: Small whole numbers are very common, e.g. as the channels of every color, so they share one
+    //               instance per value. Negative zero is excluded since it serializes differently.
+    static Array<RefPtr<NumberStyleValue const>, 256> small_integer_instances;
+    if (value >= 0 && value < small_integer_instances.size() && !signbit(value) && trunc(value) == value) {
+        auto& instance = small_integer_instances[static_cast<size_t>(value)];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) NumberStyleValue(value));
+        return *instance;
+    }
+    return adopt_ref(*new (nothrow) NumberStyleValue(value));
+}
+
 String NumberStyleValue::to_string(SerializationMode) const
 {
     return serialize_a_number(m_value);
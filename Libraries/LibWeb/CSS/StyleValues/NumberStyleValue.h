@@ -15,10 +15,7 @@ namespace Web::CSS {
 
 class NumberStyleValue final : public StyleValue {
 public:
-    static ValueComparingNonnullRefPtr<NumberStyleValue const> create(double value)
-    {
-        return adopt_ref(*new (nothrow) NumberStyleValue(value));
-    }
+    static ValueComparingNonnullRefPtr<NumberStyleValue const> create(double value);
 
     double number() const { return m_value; }
 
@@ -223,7 +223,8 @@ public:
 
     bool operator==(StyleValue const& other) const
     {
-        return this->equals(other);
+        // OPTIMIZATION: Many values are shared between styles, which makes them trivially equal.
+        return this == &other || this->equals(other);
     }
 
 protected:
@@ -138,22 +138,19 @@ void AbstractElement::set_custom_properties(OrderedHashMap<FlyString, CSS::Style
     m_element->set_custom_properties(m_pseudo_element, move(custom_properties));
 }
 
+RefPtr<CSS::CustomPropertyData const> AbstractElement::custom_property_data() const
+{
+    return m_element->custom_property_data(m_pseudo_element);
+}
+
 RefPtr<CSS::StyleValue const> AbstractElement::get_custom_property(FlyString const& name) const
 {
     // FIXME: We should be producing computed values for custom properties, just like regular properties.
-    if (m_pseudo_element.has_value()) {
-        auto const& custom_properties = m_element->custom_properties(*m_pseudo_element);
-        if (auto it = custom_properties.find(name); it != custom_properties.end()) {
-            return it->value.value;
-        }
-    }
-
-    for (auto const* current_element = m_element.ptr(); current_element; current_element = current_element->parent_or_shadow_host_element()) {
-        auto const& custom_properties = current_element->custom_properties({});
-        if (auto it = custom_properties.find(name); it != custom_properties.end()) {
-            return it->value.value;
-        }
-    }
+    auto data = custom_property_data();
+    if (!data)
+        return nullptr;
+    if (auto property = data->get(name); property.has_value())
+        return property->value;
     return nullptr;
 }
 
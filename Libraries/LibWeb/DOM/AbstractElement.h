@@ -45,6 +45,7 @@ public:
 
     void set_custom_properties(OrderedHashMap<FlyString, CSS::StyleProperty>&& custom_properties);
     [[nodiscard]] OrderedHashMap<FlyString, CSS::StyleProperty> const& custom_properties() const;
+    [[nodiscard]] RefPtr<CSS::CustomPropertyData const> custom_property_data() const;
     RefPtr<CSS::StyleValue const> get_custom_property(FlyString const& name) const;
 
     GC::Ptr<CSS::CascadedProperties> cascaded_properties() const;
@@ -1500,8 +1500,13 @@ void Document::update_layout(UpdateLayoutReason reason)
         auto& element = static_cast<Element&>(node);
         if (needs_full_style_update || node.needs_style_update() || (recompute_elements_depending_on_custom_properties && element.style_uses_var_css_function())) {
             node_invalidation = element.recompute_style(did_change_custom_properties);
-        } else if (needs_inherited_style_update) {
-            node_invalidation = element.recompute_inherited_style();
+        } else {
+            // NOTE: Elements share the custom property data they inherit, so even elements that don't depend on any
+            //       custom properties have to pick up the changed data, for their descendants to inherit it from them.
+            if (recompute_elements_depending_on_custom_properties)
+                element.update_inherited_custom_property_data();
+            if (needs_inherited_style_update)
+                node_invalidation = element.recompute_inherited_style();
         }
         is_display_none = static_cast<Element&>(node).computed_properties()->display().is_none();
     }
@@ -1528,7 +1533,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update || recompute_elements_depending_on_custom_properties) {
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
-                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
+                if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update() || recompute_elements_depending_on_custom_properties) {
                     auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties);
                     if (!is_display_none)
                         invalidation |= subtree_invalidation;
@@ -1591,7 +1596,11 @@ void Document::update_style()
 
     style_computer().reset_ancestor_filter();
 
+    // NOTE: Nothing can change the DOM while styles are being recomputed, so :has() only needs to be matched once per
+    //       anchor and argument.
+    style_computer().set_has_match_cache_enabled(true);
     auto invalidation = update_style_recursively(*this, style_computer(), false, false);
+    style_computer().set_has_match_cache_enabled(false);
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -3133,6 +3133,16 @@ void Element::set_custom_properties(Optional<CSS::PseudoElement> pseudo_element,
 {
     if (!pseudo_element.has_value()) {
         m_custom_properties = move(custom_properties);
+        RefPtr<CSS::CustomPropertyData const> inherited_data;
+        if (m_use_pseudo_element.has_value()) {
+            // NOTE: Elements that represent a pseudo-element in an internal shadow tree get their style from that
+            //       pseudo-element of the host, and so do their custom properties.
+            if (auto const* host = root().parent_or_shadow_host_element())
+                inherited_data = host->custom_property_data(m_use_pseudo_element);
+        } else if (auto const* parent = parent_or_shadow_host_element()) {
+            inherited_data = parent->m_custom_property_data;
+        }
+        m_custom_property_data = CSS::CustomPropertyData::create(m_custom_properties, move(inherited_data));
         return;
     }
 
@@ -3140,7 +3150,9 @@ void Element::set_custom_properties(Optional<CSS::PseudoElement> pseudo_element,
         return;
     }
 
-    ensure_pseudo_element(pseudo_element.value()).set_custom_properties(move(custom_properties));
+    auto& pseudo_element_data = ensure_pseudo_element(pseudo_element.value());
+    pseudo_element_data.set_custom_properties(move(custom_properties));
+    pseudo_element_data.set_custom_property_data(CSS::CustomPropertyData::create(pseudo_element_data.custom_properties(), m_custom_property_data));
 }
 
 OrderedHashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(Optional<CSS::PseudoElement> pseudo_element) const
@@ -3156,6 +3168,27 @@ OrderedHashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(
     return ensure_pseudo_element(pseudo_element.value()).custom_properties();
 }
 
+RefPtr<CSS::CustomPropertyData const> Element::custom_property_data(Optional<CSS::PseudoElement> pseudo_element) const
+{
+    if (pseudo_element.has_value() && m_pseudo_element_data) {
+        // NOTE: Pseudo-elements that don't support custom properties never get their own data, and just inherit ours.
+        if (auto it = m_pseudo_element_data->find(*pseudo_element); it != m_pseudo_element_data->end() && it->value->custom_property_data())
+            return it->value->custom_property_data();
+    }
+    return m_custom_property_data;
+}
+
+void Element::update_inherited_custom_property_data()
+{
+    set_custom_properties({}, move(m_custom_properties));
+    if (m_pseudo_element_data) {
+        for (auto& [pseudo_element, pseudo_element_data] : *m_pseudo_element_data) {
+            if (pseudo_element_data->custom_property_data())
+                set_custom_properties(pseudo_element, pseudo_element_data->custom_properties());
+        }
+    }
+}
+
 // https://drafts.csswg.org/cssom-view/#dom-element-scroll
 void Element::scroll(double x, double y)
 {
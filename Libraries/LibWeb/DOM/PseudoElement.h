@@ -10,6 +10,7 @@
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/CSS/CascadedProperties.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
 #include <LibWeb/CSS/StyleProperty.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -34,6 +35,9 @@ class WEB_API PseudoElement : public JS::Cell {
     OrderedHashMap<FlyString, CSS::StyleProperty> const& custom_properties() const { return m_custom_properties; }
     void set_custom_properties(OrderedHashMap<FlyString, CSS::StyleProperty> value) { m_custom_properties = move(value); }
 
+    RefPtr<CSS::CustomPropertyData const> const& custom_property_data() const { return m_custom_property_data; }
+    void set_custom_property_data(RefPtr<CSS::CustomPropertyData const> value) { m_custom_property_data = move(value); }
+
     bool has_non_empty_counters_set() const { return m_counters_set; }
     Optional<CSS::CountersSet const&> counters_set() const;
     CSS::CountersSet& ensure_counters_set();
@@ -49,6 +53,7 @@ private:
     GC::Ptr<CSS::CascadedProperties> m_cascaded_properties;
     GC::Ptr<CSS::ComputedProperties> m_computed_properties;
     OrderedHashMap<FlyString, CSS::StyleProperty> m_custom_properties;
+    RefPtr<CSS::CustomPropertyData const> m_custom_property_data;
     OwnPtr<CSS::CountersSet> m_counters_set;
     CSSPixelPoint m_scroll_offset {};
 };
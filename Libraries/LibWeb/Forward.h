@@ -283,6 +283,7 @@ class CSSUnparsedValue;
 class CSSVariableReferenceValue;
 class CursorStyleValue;
 class CustomIdentStyleValue;
+class CustomPropertyData;
 class DimensionStyleValue;
 class Display;
 class DisplayStyleValue;
@@ -4,10 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteString.h>
 #include <AK/MemoryStream.h>
+#include <AK/Queue.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/JPEGWriter.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/HTML/Canvas/SerializeBitmap.h>
 
 namespace Web::HTML {
@@ -23,8 +26,13 @@ ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, Strin
     if (type.equals_ignoring_ascii_case("image/jpeg"sv)) {
         AllocatingMemoryStream file;
         Gfx::JPEGWriter::Options jpeg_options;
-        if (valid_quality)
+        if (valid_quality) {
             jpeg_options.quality = static_cast<int>(quality.value() * 100);
+
+            // At high quality settings, blurring the colors would be more noticeable than the larger file size.
+            if (quality.value() >= 0.9)
+                jpeg_options.chroma_subsampling = Gfx::JPEGChromaSubsampling::Yuv444;
+        }
         TRY(Gfx::JPEGWriter::encode(file, bitmap, jpeg_options));
         return SerializeBitmapResult { TRY(file.read_until_eof()), "image/jpeg"sv };
     }
@@ -34,4 +42,71 @@ ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, Strin
     return SerializeBitmapResult { TRY(Gfx::PNGWriter::encode(bitmap)), "image/png"sv };
 }
 
+// At most this many bitmaps are waiting to be serialized in the background for each event loop. Each of them is a copy
+// of a canvas, so this bounds the memory used by a page that calls toBlob() faster than its results can be encoded.
+static constexpr size_t MAX_PENDING_BACKGROUND_SERIALIZATIONS = 4;
+static thread_local size_t s_pending_background_serializations = 0;
+
+namespace {
+
+struct PendingSerialization {
+    Function<void(Optional<SerializeBitmapResult>)> on_complete;
+    Optional<Optional<SerializeBitmapResult>> file {};
+};
+
+}
+
+// toBlob() callbacks and convertToBlob() promises have to be settled in the order they were requested, so finished
+// serializations wait here until all the ones requested before them have finished too.
+static thread_local Queue<NonnullOwnPtr<PendingSerialization>> s_pending_serializations;
+
+static void complete_finished_serializations()
+{
+    while (!s_pending_serializations.is_empty() && s_pending_serializations.head()->file.has_value()) {
+        // NOTE: The callback may hold GC roots, so it's destroyed here on this thread once it has been invoked.
+        auto serialization = s_pending_serializations.dequeue();
+        serialization->on_complete(serialization->file.release_value());
+    }
+}
+
+static Optional<SerializeBitmapResult> serialize_bitmap_or_log_error(Gfx::Bitmap const& bitmap, StringView type, Optional<double> quality)
+{
+    auto result = serialize_bitmap(bitmap, type, quality);
+    if (result.is_error()) {
+        dbgln("Failed to encode canvas bitmap to {}: {}", type, result.error());
+        return {};
+    }
+    return result.release_value();
+}
+
+void serialize_bitmap_in_background(NonnullRefPtr<Gfx::Bitmap> bitmap, StringView type, Optional<double> quality, Function<void(Optional<SerializeBitmapResult>)> on_complete)
+{
+    auto serialization = make<PendingSerialization>(PendingSerialization { .on_complete = move(on_complete) });
+    auto& pending_serialization = *serialization;
+    s_pending_serializations.enqueue(move(serialization));
+
+    // Once too many bitmaps are queued up, serialize on this thread instead, which slows the page down to the speed
+    // of the encoder. The result still waits for the serializations ahead of it in the background.
+    if (s_pending_background_serializations >= MAX_PENDING_BACKGROUND_SERIALIZATIONS) {
+        pending_serialization.file = serialize_bitmap_or_log_error(*bitmap, type, quality);
+        complete_finished_serializations();
+        return;
+    }
+
+    // NOTE: Encoding a large canvas takes long enough to noticeably block the page, so it's done on the shared
+    //       background thread, one bitmap after another. Failures are reported through an empty result rather than
+    //       BackgroundAction's error callback, since that one may be called on the background thread.
+    ++s_pending_background_serializations;
+    (void)Threading::BackgroundAction<Optional<SerializeBitmapResult>>::construct(
+        [bitmap = move(bitmap), type = ByteString { type }, quality](auto&) -> ErrorOr<Optional<SerializeBitmapResult>> {
+            return serialize_bitmap_or_log_error(*bitmap, type, quality);
+        },
+        [&pending_serialization](Optional<SerializeBitmapResult> file) -> ErrorOr<void> {
+            --s_pending_background_serializations;
+            pending_serialization.file = move(file);
+            complete_finished_serializations();
+            return {};
+        });
+}
+
 }
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/DOM/Document.h>
 
@@ -20,4 +22,10 @@ struct SerializeBitmapResult {
 // https://html.spec.whatwg.org/multipage/canvas.html#a-serialisation-of-the-bitmap-as-a-file
 ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, StringView type, Optional<double> quality);
 
+// Serializes the bitmap on the background thread shared by all BackgroundActions, and then invokes on_complete on the
+// current event loop with the file, or with an empty Optional if serialization failed. The bitmap must not be modified
+// until then. If too many bitmaps are already waiting to be serialized, this serializes the bitmap on the current
+// thread instead. Either way, callbacks are invoked in the order this was called.
+void serialize_bitmap_in_background(NonnullRefPtr<Gfx::Bitmap> bitmap, StringView type, Optional<double> quality, Function<void(Optional<SerializeBitmapResult>)> on_complete);
+
 }
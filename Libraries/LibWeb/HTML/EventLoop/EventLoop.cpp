@@ -582,6 +582,15 @@ void queue_a_microtask(DOM::Document const* document, GC::Ref<GC::Function<void(
     event_loop.microtask_queue().enqueue(microtask);
 }
 
+// Queues a microtask that runs a promise reaction job, without allocating a closure for its steps.
+void queue_a_promise_reaction_microtask(DOM::Document const* document, Task::PromiseReactionJob job)
+{
+    // NOTE: These are the steps of queue_a_microtask() above.
+    auto& event_loop = HTML::main_thread_event_loop();
+    auto microtask = HTML::Task::create_promise_reaction_microtask(event_loop.vm(), document, move(job));
+    event_loop.microtask_queue().enqueue(microtask);
+}
+
 void perform_a_microtask_checkpoint()
 {
     main_thread_event_loop().perform_a_microtask_checkpoint();
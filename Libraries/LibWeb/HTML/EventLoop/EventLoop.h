@@ -150,6 +150,7 @@ WEB_API void run_when_event_loop_reaches_step_1(GC::Ref<GC::Function<void()>> st
 WEB_API TaskID queue_a_task(HTML::Task::Source, GC::Ptr<EventLoop>, GC::Ptr<DOM::Document>, GC::Ref<GC::Function<void()>> steps);
 WEB_API TaskID queue_global_task(HTML::Task::Source, JS::Object&, GC::Ref<GC::Function<void()>> steps);
 WEB_API void queue_a_microtask(DOM::Document const*, GC::Ref<GC::Function<void()>> steps);
+void queue_a_promise_reaction_microtask(DOM::Document const*, Task::PromiseReactionJob);
 void perform_a_microtask_checkpoint();
 
 }
@@ -5,6 +5,9 @@
  */
 
 #include <AK/IDAllocator.h>
+#include <LibJS/Runtime/PromiseJobs.h>
+#include <LibJS/Runtime/PromiseReaction.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
@@ -25,6 +28,11 @@ GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document cons
     return vm.heap().allocate<Task>(source, document, move(steps));
 }
 
+GC::Ref<Task> Task::create_promise_reaction_microtask(JS::VM& vm, GC::Ptr<DOM::Document const> document, PromiseReactionJob job)
+{
+    return vm.heap().allocate<Task>(document, move(job));
+}
+
 Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
@@ -33,6 +41,14 @@ Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Fun
 {
 }
 
+Task::Task(GC::Ptr<DOM::Document const> document, PromiseReactionJob job)
+    : m_id(allocate_task_id())
+    , m_source(Source::Microtask)
+    , m_promise_reaction_job(move(job))
+    , m_document(document)
+{
+}
+
 Task::~Task() = default;
 
 void Task::visit_edges(Visitor& visitor)
@@ -40,10 +56,26 @@ void Task::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_steps);
     visitor.visit(m_document);
+    if (m_promise_reaction_job.has_value()) {
+        visitor.visit(m_promise_reaction_job->reaction);
+        visitor.visit(m_promise_reaction_job->argument);
+        visitor.visit(m_promise_reaction_job->realm);
+        m_promise_reaction_job->script_or_module.visit(
+            [](Empty) {},
+            [&](auto const& script_or_module) { visitor.visit(script_or_module); });
+    }
 }
 
 void Task::execute()
 {
+    if (m_promise_reaction_job.has_value()) {
+        auto& job = *m_promise_reaction_job;
+        Bindings::run_promise_job(vm(), job.realm, job.script_or_module, [&] {
+            return JS::run_promise_reaction_job(vm(), job.reaction, job.argument);
+        });
+        return;
+    }
+
     m_steps->function()();
 }
 
@@ -9,6 +9,8 @@
 #include <AK/DistinctNumeric.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/Value.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 
@@ -90,7 +92,16 @@ public:
         UniqueTaskSourceStart
     };
 
+    // The state of a promise reaction job queued by HostEnqueuePromiseJob, which a microtask runs directly.
+    struct PromiseReactionJob {
+        GC::Ref<JS::PromiseReaction> reaction;
+        JS::Value argument;
+        GC::Ptr<JS::Realm> realm;
+        JS::ScriptOrModule script_or_module;
+    };
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
+    static GC::Ref<Task> create_promise_reaction_microtask(JS::VM&, GC::Ptr<DOM::Document const>, PromiseReactionJob);
 
     virtual ~Task() override;
 
@@ -104,12 +115,16 @@ public:
 
 private:
     Task(Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
+    Task(GC::Ptr<DOM::Document const>, PromiseReactionJob);
 
     virtual void visit_edges(Visitor&) override;
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
-    GC::Ref<GC::Function<void()>> m_steps;
+    // NOTE: A task either has its steps, or is a microtask for a promise reaction job. The latter is the most common
+    //       kind of microtask by far, so it's stored inline instead of allocating a closure for it.
+    GC::Ptr<GC::Function<void()>> m_steps;
+    Optional<PromiseReactionJob> m_promise_reaction_job;
     GC::Ptr<DOM::Document const> m_document;
 };
 
@@ -340,29 +340,34 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::to_blob(GC::Ref<WebIDL::CallbackTyp
     Optional<double> quality = js_quality.is_number() ? js_quality.as_double() : Optional<double>();
 
     // 4. Run these steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this, callback, bitmap_result, type, quality] {
-        // 1. If result is non-null, then set result to a serialization of result as a file with type and quality if given.
-        Optional<SerializeBitmapResult> file_result;
-        if (bitmap_result) {
-            if (auto result = serialize_bitmap(*bitmap_result, type, quality); !result.is_error())
-                file_result = result.release_value();
-        }
-
+    // NOTE: Step 1 runs on a background thread, which then hands its result back to this event loop for step 2.
+    auto on_serialized = [self = GC::make_root(*this), callback = GC::make_root(callback)](Optional<SerializeBitmapResult> file_result) {
         // 2. Queue an element task on the canvas blob serialization task source given the canvas element to run these steps:
-        queue_an_element_task(Task::Source::CanvasBlobSerializationTask, [this, callback, file_result = move(file_result)] {
-            auto maybe_error = Bindings::throw_dom_exception_if_needed(vm(), [&]() -> WebIDL::ExceptionOr<void> {
+        self->queue_an_element_task(Task::Source::CanvasBlobSerializationTask, [self, callback, file_result = move(file_result)] {
+            auto& realm = self->realm();
+            auto maybe_error = Bindings::throw_dom_exception_if_needed(realm.vm(), [&]() -> WebIDL::ExceptionOr<void> {
                 // 1. If result is non-null, then set result to a new Blob object, created in the relevant realm of this canvas element, representing result. [FILEAPI]
                 GC::Ptr<FileAPI::Blob> blob_result;
                 if (file_result.has_value())
-                    blob_result = FileAPI::Blob::create(realm(), file_result->buffer, TRY_OR_THROW_OOM(vm(), String::from_utf8(file_result->mime_type)));
+                    blob_result = FileAPI::Blob::create(realm, file_result->buffer, TRY_OR_THROW_OOM(realm.vm(), String::from_utf8(file_result->mime_type)));
 
                 // 2. Invoke callback with « result » and "report".
                 TRY(WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Report, { { blob_result } }));
                 return {};
             });
             if (maybe_error.is_throw_completion())
-                report_exception(maybe_error.throw_completion(), realm());
+                report_exception(maybe_error.throw_completion(), realm);
         });
+    };
+
+    // 1. If result is non-null, then set result to a serialization of result as a file with type and quality if given.
+    if (bitmap_result) {
+        serialize_bitmap_in_background(bitmap_result.release_nonnull(), type, quality, move(on_serialized));
+        return {};
+    }
+
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [on_serialized = move(on_serialized)] {
+        on_serialized({});
     }));
     return {};
 }
@@ -297,41 +297,36 @@ GC::Ref<WebIDL::Promise> OffscreenCanvas::convert_to_blob(Optional<ImageEncodeOp
     auto result_promise = WebIDL::create_promise(realm());
 
     // 6. Run these steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this, result_promise, bitmap, maybe_options] {
-        // 1. Let file be a serialization of bitmap as a file, with options's type and quality if present.
-        Optional<SerializeBitmapResult> file_result {};
-        auto options = options_convert_or_default(maybe_options);
-
-        if (auto result = serialize_bitmap(*bitmap, options.get<0>(), options.get<1>()); !result.is_error())
-            file_result = result.release_value();
-
+    // NOTE: Step 1 runs on a background thread, which then hands its result back to this event loop for step 2.
+    auto on_serialized = [self = GC::make_root(*this), result_promise = GC::make_root(result_promise)](Optional<SerializeBitmapResult> file_result) {
         // 2. Queue an element task on the canvas blob serialization task source given the canvas element to run these steps:
         // FIXME: wait for spec bug to be resolve: https://github.com/whatwg/html/issues/11101
 
         // AD-HOC: queue the task in an appropiate queue. This depends if the global object is a window or a worker
-        Function<void()> task_to_queue = [this, result_promise, file_result = move(file_result)] -> void {
-            HTML::TemporaryExecutionContext context(realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        Function<void()> task_to_queue = [self, result_promise, file_result = move(file_result)] -> void {
+            auto& realm = self->realm();
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
             // 1. If file is null, then reject result with an "EncodingError" DOMException.
             if (!file_result.has_value()) {
-                auto error = WebIDL::EncodingError::create(realm(), "Failed to convert OffscreenCanvas to Blob"_utf16);
+                auto error = WebIDL::EncodingError::create(realm, "Failed to convert OffscreenCanvas to Blob"_utf16);
 
-                WebIDL::reject_promise(realm(), result_promise, error);
+                WebIDL::reject_promise(realm, *result_promise, error);
             } else {
                 // 1. If result is non-null, resolve result with a new Blob object, created in the relevant realm of this OffscreenCanvas object, representing file. [FILEAPI]
                 auto type = String::from_utf8(file_result->mime_type);
                 if (type.is_error()) {
-                    auto error = WebIDL::EncodingError::create(realm(), Utf16String::formatted("OOM Error while converting string in OffscreenCanvas to blob: {}", type.error()));
-                    WebIDL::reject_promise(realm(), result_promise, error);
+                    auto error = WebIDL::EncodingError::create(realm, Utf16String::formatted("OOM Error while converting string in OffscreenCanvas to blob: {}", type.error()));
+                    WebIDL::reject_promise(realm, *result_promise, error);
                     return;
                 }
 
-                GC::Ptr<FileAPI::Blob> blob_result = FileAPI::Blob::create(realm(), file_result->buffer, type.release_value());
-                WebIDL::resolve_promise(realm(), result_promise, blob_result);
+                GC::Ptr<FileAPI::Blob> blob_result = FileAPI::Blob::create(realm, file_result->buffer, type.release_value());
+                WebIDL::resolve_promise(realm, *result_promise, blob_result);
             }
         };
 
-        auto& global_object = HTML::relevant_global_object(*this);
+        auto& global_object = HTML::relevant_global_object(*self);
 
         // AD-HOC: if the global_object is a window, queue an element task on the canvas blob serialization task source
         if (is<HTML::Window>(global_object)) {
@@ -346,8 +341,18 @@ GC::Ref<WebIDL::Promise> OffscreenCanvas::convert_to_blob(Optional<ImageEncodeOp
         auto& worker = as<HTML::WorkerGlobalScope>(global_object);
 
         // AD-HOC: if the global_object is a worker, queue a global task on the canvas blob serialization task source
-        HTML::queue_global_task(Task::Source::CanvasBlobSerializationTask, worker, GC::create_function(heap(), move(task_to_queue)));
-    }));
+        HTML::queue_global_task(Task::Source::CanvasBlobSerializationTask, worker, GC::create_function(self->heap(), move(task_to_queue)));
+    };
+
+    // 1. Let file be a serialization of bitmap as a file, with options's type and quality if present.
+    if (bitmap) {
+        auto options = options_convert_or_default(maybe_options);
+        serialize_bitmap_in_background(bitmap.release_nonnull(), options.get<0>(), options.get<1>(), move(on_serialized));
+    } else {
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [on_serialized = move(on_serialized)] {
+            on_serialized({});
+        }));
+    }
 
     // 7. Return result.
     return result_promise;
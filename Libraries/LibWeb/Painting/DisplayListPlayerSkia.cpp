@@ -168,7 +168,29 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     paint.setAntiAlias(true);
     canvas.save();
     canvas.clipRect(clip_rect, true);
-    canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+
+    // OPTIMIZATION: Very large images are drawn from a cached downscaled copy that is closest to the size they end up
+    //               at on the device, and only the part of the image that is visible through the clip is drawn.
+    //               This keeps the cost of drawing them bounded by the size of the viewport, not of the image.
+    SkRect visible_rect = dst_rect;
+    if (dst_rect.isEmpty() || !visible_rect.intersect(canvas.getLocalClipBounds())) {
+        canvas.restore();
+        return;
+    }
+    auto device_rect = canvas.getTotalMatrix().mapRect(dst_rect).roundOut();
+    auto image = command.bitmap->sk_image_for_size<sk_sp<SkImage>>({ device_rect.width(), device_rect.height() });
+
+    auto scale_x = image->width() / dst_rect.width();
+    auto scale_y = image->height() / dst_rect.height();
+    auto src_rect = SkRect::MakeXYWH(
+        (visible_rect.x() - dst_rect.x()) * scale_x,
+        (visible_rect.y() - dst_rect.y()) * scale_y,
+        visible_rect.width() * scale_x,
+        visible_rect.height() * scale_y);
+
+    // The fast constraint lets filtering sample past the edges of the visible part, like it would when drawing the
+    // whole image.
+    canvas.drawImageRect(image.get(), src_rect, visible_rect, to_skia_sampling_options(command.scaling_mode), &paint, SkCanvas::kFast_SrcRectConstraint);
     canvas.restore();
 }
 
@@ -130,11 +130,17 @@ WebIDL::ExceptionOr<void> AudioBufferSourceNode::start(Optional<double> when, Op
     // 3. Set the internal slot [[source started]] on this AudioBufferSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
-    // FIXME: 5. Acquire the contents of the buffer if the buffer has been set.
+    // 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
+    // NOTE: The render graph picks these up when it is compiled.
+    set_start_time(when.value_or(0));
+    m_start_offset = offset;
+    m_start_duration = duration;
+
+    // 5. Acquire the contents of the buffer if the buffer has been set.
+    // NOTE: The render graph takes a copy of the buffer's channel data when it is compiled.
+
     // FIXME: 6. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
 
-    dbgln("FIXME: Implement AudioBufferSourceNode::start(when, offset, duration)");
     return {};
 }
 
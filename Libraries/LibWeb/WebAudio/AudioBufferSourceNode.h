@@ -46,6 +46,10 @@ public:
 
     WebIDL::ExceptionOr<void> start(Optional<double>, Optional<double>, Optional<double>);
 
+    // The offset and duration passed to start(), if any.
+    Optional<double> start_offset() const { return m_start_offset; }
+    Optional<double> start_duration() const { return m_start_duration; }
+
     static WebIDL::ExceptionOr<GC::Ref<AudioBufferSourceNode>> create(JS::Realm&, GC::Ref<BaseAudioContext>, AudioBufferSourceOptions const& = {});
     static WebIDL::ExceptionOr<GC::Ref<AudioBufferSourceNode>> construct_impl(JS::Realm&, GC::Ref<BaseAudioContext>, AudioBufferSourceOptions const& = {});
 
@@ -64,6 +68,8 @@ private:
     bool m_buffer_set { false };
     double m_loop_start { 0.0 };
     double m_loop_end { 0.0 };
+    Optional<double> m_start_offset;
+    Optional<double> m_start_duration;
 };
 
 }
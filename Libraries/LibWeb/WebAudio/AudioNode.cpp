@@ -7,6 +7,7 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
@@ -112,6 +113,7 @@ WebIDL::ExceptionOr<void> AudioNode::connect(GC::Ref<AudioParam> destination_par
 
     // Connect node's output to destination_param.
     m_param_connections.append(param_connection);
+    destination_param->add_input_node({}, *this);
 
     return {};
 }
@@ -128,6 +130,8 @@ void AudioNode::disconnect()
         });
     }
 
+    for (auto& connection : m_param_connections)
+        connection.destination_param->remove_input_node({}, *this);
     m_param_connections.clear();
 }
 
@@ -153,7 +157,11 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(WebIDL::UnsignedLong output)
     });
 
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.output == output;
+        if (connection.output != output)
+            return false;
+
+        connection.destination_param->remove_input_node({}, *this);
+        return true;
     });
 
     return {};
@@ -255,7 +263,11 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_
     // The destinationParam parameter is the AudioParam to disconnect.
     auto before = m_param_connections.size();
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.destination_param == destination_param;
+        if (connection.destination_param != destination_param)
+            return false;
+
+        connection.destination_param->remove_input_node({}, *this);
+        return true;
     });
 
     // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
@@ -277,7 +289,11 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_
     // The destinationParam parameter is the AudioParam to disconnect.
     auto before = m_param_connections.size();
     m_param_connections.remove_all_matching([&](AudioParamConnection& connection) {
-        return connection.destination_param == destination_param && connection.output == output;
+        if (connection.destination_param != destination_param || connection.output != output)
+            return false;
+
+        connection.destination_param->remove_input_node({}, *this);
+        return true;
     });
 
     // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
@@ -84,6 +84,9 @@ public:
     virtual WebIDL::ExceptionOr<void> set_channel_interpretation(Bindings::ChannelInterpretation);
     Bindings::ChannelInterpretation channel_interpretation();
 
+    // Connections from other AudioNode outputs into this node's inputs.
+    ReadonlySpan<AudioNodeConnection> input_connections() const { return m_input_connections; }
+
     WebIDL::ExceptionOr<void> initialize_audio_node_options(AudioNodeOptions const& given_options, AudioNodeDefaultOptions const& default_options);
 
 protected:
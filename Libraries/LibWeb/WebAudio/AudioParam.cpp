@@ -6,6 +6,7 @@
 
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -82,69 +83,163 @@ float AudioParam::max_value() const
     return m_max_value;
 }
 
+WebIDL::ExceptionOr<void> AudioParam::verify_not_within_value_curve(double time) const
+{
+    // If any of these automation methods are called at a time which is contained in [T, T + D), T being startTime and
+    // D being duration of a setValueCurveAtTime() event, a NotSupportedError exception MUST be thrown.
+    if (m_timeline.is_within_value_curve(time))
+        return WebIDL::NotSupportedError::create(realm(), "Automation event overlaps a value curve"_utf16);
+    return {};
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_value_at_time(float value, double start_time)
 {
-    (void)value;
-    (void)start_time;
-    dbgln("FIXME: Implement AudioParam::set_value_at_time");
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+    TRY(verify_not_within_value_curve(start_time));
+
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::SetValue, .time = start_time, .value = value });
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-linearramptovalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::linear_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    dbgln("FIXME: Implement AudioParam::linear_ramp_to_value_at_time");
+    // If endTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "endTime must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    end_time = max(end_time, m_context->current_time());
+    TRY(verify_not_within_value_curve(end_time));
+
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::LinearRamp, .time = end_time, .value = value });
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-exponentialramptovalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::exponential_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    dbgln("FIXME: Implement AudioParam::exponential_ramp_to_value_at_time");
+    // If this value is equal to 0, a RangeError exception MUST be thrown.
+    if (value == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "value must not be zero"sv };
+
+    // If endTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "endTime must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    end_time = max(end_time, m_context->current_time());
+    TRY(verify_not_within_value_curve(end_time));
+
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::ExponentialRamp, .time = end_time, .value = value });
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_target_at_time(float target, double start_time, float time_constant)
 {
-    (void)target;
-    (void)start_time;
-    (void)time_constant;
-    dbgln("FIXME: Implement AudioParam::set_target_at_time");
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // If timeConstant is negative, a RangeError exception MUST be thrown.
+    if (time_constant < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "timeConstant must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+    TRY(verify_not_within_value_curve(start_time));
+
+    // If timeConstant is zero, the output value jumps immediately to the final value.
+    if (time_constant == 0) {
+        m_timeline.insert({ .type = AudioParamTimeline::Event::Type::SetValue, .time = start_time, .value = target });
+        return GC::Ref { *this };
+    }
+
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::SetTarget, .time = start_time, .value = target, .time_constant = time_constant });
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_value_curve_at_time(Span<float> values, double start_time, double duration)
 {
-    (void)values;
-    (void)start_time;
-    (void)duration;
-    dbgln("FIXME: Implement AudioParam::set_value_curve_at_time");
+    // An InvalidStateError MUST be thrown if this attribute is a sequence<float> object that has a length less than 2.
+    if (values.size() < 2)
+        return WebIDL::InvalidStateError::create(realm(), "Value curve must have at least two values"_utf16);
+
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // If duration is not strictly positive or is not a finite number, a RangeError exception MUST be thrown.
+    if (duration <= 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "duration must be strictly positive"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+
+    // If setValueCurveAtTime() is called for time T and duration D and there are any events having a time strictly
+    // greater than T, but strictly less than T + D, then a NotSupportedError exception MUST be thrown.
+    if (m_timeline.has_event_within(start_time, start_time + duration))
+        return WebIDL::NotSupportedError::create(realm(), "Value curve overlaps another automation event"_utf16);
+
+    Vector<float> curve;
+    curve.append(values.data(), values.size());
+    auto last_value = curve.last();
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::SetValueCurve, .time = start_time, .duration = duration, .curve = move(curve) });
+
+    // An implicit call to setValueAtTime() is made at time T + TD with value V[N - 1] so that following automations
+    // will start from the end of the setValueCurveAtTime() event.
+    m_timeline.insert({ .type = AudioParamTimeline::Event::Type::SetValue, .time = start_time + duration, .value = last_value });
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelscheduledvalues
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::cancel_scheduled_values(double cancel_time)
 {
-    (void)cancel_time;
-    dbgln("FIXME: Implement AudioParam::cancel_scheduled_values");
+    // If cancelTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (cancel_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "cancelTime must not be negative"sv };
+
+    // If cancelTime is less than currentTime, it is clamped to currentTime.
+    cancel_time = max(cancel_time, m_context->current_time());
+
+    m_timeline.cancel_scheduled_values(cancel_time);
     return GC::Ref { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelandholdattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::cancel_and_hold_at_time(double cancel_time)
 {
-    (void)cancel_time;
-    dbgln("FIXME: Implement AudioParam::cancel_and_hold_at_time");
+    // If cancelTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (cancel_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "cancelTime must not be negative"sv };
+
+    // If cancelTime is less than currentTime, it is clamped to currentTime.
+    cancel_time = max(cancel_time, m_context->current_time());
+
+    m_timeline.cancel_and_hold(cancel_time, m_current_value);
     return GC::Ref { *this };
 }
 
+void AudioParam::add_input_node(Badge<AudioNode>, GC::Ref<AudioNode> node)
+{
+    m_input_nodes.append(node);
+}
+
+void AudioParam::remove_input_node(Badge<AudioNode>, AudioNode const& node)
+{
+    // NOTE: A node with several outputs may be connected to this param more than once, so only drop one connection.
+    if (auto index = m_input_nodes.find_first_index_if([&](auto const& input_node) { return input_node.ptr() == &node; }); index.has_value())
+        m_input_nodes.remove(*index);
+}
+
 void AudioParam::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioParam);
@@ -155,6 +250,7 @@ void AudioParam::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    visitor.visit(m_input_nodes);
 }
 
 }
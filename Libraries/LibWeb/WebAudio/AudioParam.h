@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
 
 namespace Web::WebAudio {
 
@@ -46,6 +48,15 @@ public:
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_scheduled_values(double cancel_time);
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_and_hold_at_time(double cancel_time);
 
+    // The value used when no automation event applies, which is what the value attribute was last set to.
+    float intrinsic_value() const { return m_current_value; }
+    AudioParamTimeline const& timeline() const { return m_timeline; }
+
+    // The AudioNodes whose outputs are connected to this AudioParam.
+    ReadonlySpan<GC::Ref<AudioNode>> input_nodes() const { return m_input_nodes; }
+    void add_input_node(Badge<AudioNode>, GC::Ref<AudioNode>);
+    void remove_input_node(Badge<AudioNode>, AudioNode const&);
+
 private:
     AudioParam(JS::Realm&, GC::Ref<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate, FixedAutomationRate = FixedAutomationRate::No);
 
@@ -63,6 +74,12 @@ private:
 
     FixedAutomationRate m_fixed_automation_rate { FixedAutomationRate::No };
 
+    AudioParamTimeline m_timeline;
+
+    Vector<GC::Ref<AudioNode>> m_input_nodes;
+
+    WebIDL::ExceptionOr<void> verify_not_within_value_curve(double time) const;
+
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 };
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
+
+namespace Web::WebAudio {
+
+bool AudioParamTimeline::is_within_value_curve(double time) const
+{
+    for (auto const& event : m_events) {
+        if (event.type == Event::Type::SetValueCurve && time >= event.time && time < event.end_time())
+            return true;
+    }
+    return false;
+}
+
+bool AudioParamTimeline::has_event_within(double start_time, double end_time) const
+{
+    for (auto const& event : m_events) {
+        if (event.time > start_time && event.time < end_time)
+            return true;
+        if (event.type == Event::Type::SetValueCurve && start_time >= event.time && start_time < event.end_time())
+            return true;
+    }
+    return false;
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
+void AudioParamTimeline::insert(Event event)
+{
+    // If one of these events is added at a time where there is already one or more events, then it will be placed in
+    // the list after them, but before events whose times are after the event.
+    auto index = m_events.find_first_index_if([&](auto const& existing_event) {
+        return existing_event.time > event.time;
+    });
+    m_events.insert(index.value_or(m_events.size()), move(event));
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelscheduledvalues
+void AudioParamTimeline::cancel_scheduled_values(double cancel_time)
+{
+    // Removes all scheduled parameter changes with times greater than or equal to cancelTime. Any active
+    // setValueCurveAtTime() automation at cancelTime is removed as well.
+    m_events.remove_all_matching([&](auto const& event) {
+        return event.time >= cancel_time || event.end_time() > cancel_time;
+    });
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelandholdattime
+void AudioParamTimeline::cancel_and_hold(double cancel_time, float default_value)
+{
+    auto held_value = value_at_time(cancel_time, default_value);
+
+    auto next_index = m_events.find_first_index_if([&](auto const& event) {
+        return event.time > cancel_time;
+    });
+    auto next_type = next_index.has_value() ? Optional<Event::Type> { m_events[*next_index].type } : Optional<Event::Type> {};
+
+    // Events scheduled after cancelTime, as well as a value curve that is still running at cancelTime, are removed.
+    m_events.remove_all_matching([&](auto const& event) {
+        return event.time > cancel_time || event.end_time() > cancel_time;
+    });
+
+    // If the event after cancelTime was a ramp, it's replaced by an equivalent ramp that ends at cancelTime with the
+    // value the ramp would have had at that time. Otherwise, the value at cancelTime is held by a SetValue event.
+    if (next_type.has_value() && (*next_type == Event::Type::LinearRamp || *next_type == Event::Type::ExponentialRamp))
+        m_events.append({ .type = *next_type, .time = cancel_time, .value = held_value });
+    else
+        m_events.append({ .type = Event::Type::SetValue, .time = cancel_time, .value = held_value });
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
+static float value_curve_value(AudioParamTimeline::Event const& event, double time)
+{
+    // Let T0 be startTime, TD be duration, V be the values array, and N be the length of the values array. Then,
+    // during the time interval T0 ≤ t < T0 + TD, let k = ⌊(N − 1) / TD * (t − T0)⌋.
+    // Then v(t) is computed by linearly interpolating between V[k] and V[k + 1].
+    auto const& curve = event.curve;
+    auto position = (curve.size() - 1) / event.duration * (time - event.time);
+    auto k = static_cast<size_t>(position);
+    if (k + 1 >= curve.size())
+        return curve.last();
+    return curve[k] + (curve[k + 1] - curve[k]) * static_cast<float>(position - k);
+}
+
+// Fills values with first_value, first_value + step, first_value + 2 * step, and so on.
+static void fill_linear(Span<float> values, double first_value, double step)
+{
+    static constexpr auto lanes = SIMD::vector_length<SIMD::f32x4>;
+
+    size_t i = 0;
+    auto first_vector = SIMD::expand4(static_cast<float>(first_value));
+    auto step_vector = SIMD::expand4(static_cast<float>(step));
+    SIMD::f32x4 lane_offsets { 0, 1, 2, 3 };
+    for (; i + lanes <= values.size(); i += lanes) {
+        auto indices = SIMD::expand4(static_cast<float>(i)) + lane_offsets;
+        SIMD::store_unaligned(&values[i], first_vector + indices * step_vector);
+    }
+    for (; i < values.size(); ++i)
+        values[i] = static_cast<float>(first_value + step * i);
+}
+
+// Fills values with offset + scale, offset + scale * ratio, offset + scale * ratio^2, and so on.
+static void fill_exponential(Span<float> values, double offset, double scale, double ratio)
+{
+    static constexpr auto lanes = SIMD::vector_length<SIMD::f32x4>;
+
+    size_t i = 0;
+    auto ratio_squared = ratio * ratio;
+    auto offset_vector = SIMD::expand4(static_cast<float>(offset));
+    auto ratio_vector = SIMD::expand4(static_cast<float>(ratio_squared * ratio_squared));
+    SIMD::f32x4 terms {
+        static_cast<float>(scale),
+        static_cast<float>(scale * ratio),
+        static_cast<float>(scale * ratio_squared),
+        static_cast<float>(scale * ratio_squared * ratio),
+    };
+    for (; i + lanes <= values.size(); i += lanes) {
+        SIMD::store_unaligned(&values[i], offset_vector + terms);
+        terms *= ratio_vector;
+    }
+
+    auto term = scale * AK::pow(ratio, static_cast<double>(i));
+    for (; i < values.size(); ++i) {
+        values[i] = static_cast<float>(offset + term);
+        term *= ratio;
+    }
+}
+
+AudioParamTimeline::Cursor AudioParamTimeline::create_cursor(float default_value) const
+{
+    Cursor cursor { .default_value = default_value };
+    cursor.event_start_values.ensure_capacity(m_events.size());
+    for (size_t i = 0; i < m_events.size(); ++i) {
+        // A ramp starts at the time and value of the previous event, or at time 0 with the intrinsic value. Other
+        // events start from the value the timeline has at their own time.
+        auto start_time = m_events[i].time;
+        if (m_events[i].is_ramp())
+            start_time = i > 0 ? m_events[i - 1].end_time() : 0;
+        cursor.event_start_values.unchecked_append(value_after_events(cursor, i, start_time));
+    }
+    return cursor;
+}
+
+void AudioParamTimeline::move_cursor_to(Cursor& cursor, double time) const
+{
+    auto& index = cursor.next_event_index;
+    while (index < m_events.size() && m_events[index].time <= time)
+        ++index;
+    while (index > 0 && m_events[index - 1].time > time)
+        --index;
+}
+
+// Returns the value at the given time if only the first event_count events had been scheduled. All of those events
+// must be at or before that time.
+float AudioParamTimeline::value_after_events(Cursor const& cursor, size_t event_count, double time) const
+{
+    if (event_count == 0)
+        return cursor.default_value;
+
+    auto const& event = m_events[event_count - 1];
+    switch (event.type) {
+    case Event::Type::SetValue:
+    case Event::Type::LinearRamp:
+    case Event::Type::ExponentialRamp:
+        return event.value;
+    case Event::Type::SetTarget: {
+        // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
+        // v(t) = V1 + (V0 − V1) * e^(−(t − T0) / τ)
+        auto start_value = cursor.event_start_values[event_count - 1];
+        return event.value + (start_value - event.value) * static_cast<float>(AK::exp(-(time - event.time) / event.time_constant));
+    }
+    case Event::Type::SetValueCurve:
+        // A value curve keeps running past the time of the events that follow it in the list until its duration is over.
+        if (time < event.end_time())
+            return value_curve_value(event, time);
+        return event.curve.last();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+float AudioParamTimeline::ramp_value(Cursor const& cursor, size_t ramp_index, double time) const
+{
+    auto const& ramp = m_events[ramp_index];
+    auto start_time = ramp_index > 0 ? m_events[ramp_index - 1].end_time() : 0;
+    auto start_value = cursor.event_start_values[ramp_index];
+
+    auto duration = ramp.time - start_time;
+    if (duration <= 0)
+        return ramp.value;
+    auto progress = (time - start_time) / duration;
+
+    if (ramp.type == Event::Type::LinearRamp) {
+        // v(t) = V0 + (V1 − V0) * ((t − T0) / (T1 − T0))
+        return start_value + (ramp.value - start_value) * static_cast<float>(progress);
+    }
+
+    // v(t) = V0 * (V1 / V0) ^ ((t − T0) / (T1 − T0))
+    // If V0 and V1 have opposite signs or if V0 is zero, then v(t) = V0 for T0 ≤ t < T1.
+    if (start_value == 0 || (start_value < 0) != (ramp.value < 0))
+        return start_value;
+    return start_value * static_cast<float>(AK::pow(static_cast<double>(ramp.value) / start_value, progress));
+}
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+float AudioParamTimeline::value_at_time(double time, float default_value) const
+{
+    auto cursor = create_cursor(default_value);
+    return value_at_time(cursor, time);
+}
+
+float AudioParamTimeline::value_at_time(Cursor& cursor, double time) const
+{
+    move_cursor_to(cursor, time);
+    auto index = cursor.next_event_index;
+
+    auto is_in_value_curve = index > 0 && m_events[index - 1].type == Event::Type::SetValueCurve && time < m_events[index - 1].end_time();
+    if (!is_in_value_curve && index < m_events.size() && m_events[index].is_ramp())
+        return ramp_value(cursor, index, time);
+    return value_after_events(cursor, index, time);
+}
+
+void AudioParamTimeline::compute_values(Cursor& cursor, Span<float> values, double start_time, double sample_duration) const
+{
+    // OPTIMIZATION: Most params are never automated, so we can fill the whole block with a single value.
+    if (m_events.is_empty()) {
+        values.fill(cursor.default_value);
+        return;
+    }
+
+    auto time_of_frame = [&](size_t frame) { return start_time + frame * sample_duration; };
+
+    // OPTIMIZATION: Between two events, the values follow a single formula, so instead of evaluating the timeline for
+    //               each frame, we fill each such segment of the block in one go.
+    size_t frame = 0;
+    while (frame < values.size()) {
+        auto time = time_of_frame(frame);
+        move_cursor_to(cursor, time);
+        auto index = cursor.next_event_index;
+        auto const* previous = index > 0 ? &m_events[index - 1] : nullptr;
+        auto const* next = index < m_events.size() ? &m_events[index] : nullptr;
+        auto is_in_value_curve = previous && previous->type == Event::Type::SetValueCurve && time < previous->end_time();
+
+        // The segment lasts until the next event starts, or until the value curve we're in ends.
+        auto segment_end_time = next ? next->time : AK::Infinity<double>;
+        if (is_in_value_curve)
+            segment_end_time = min(segment_end_time, previous->end_time());
+        auto frames_until_segment_end = AK::ceil((segment_end_time - start_time) / sample_duration);
+        auto segment_end = static_cast<size_t>(clamp(frames_until_segment_end, static_cast<double>(frame + 1), static_cast<double>(values.size())));
+        // NOTE: The division above may round differently from the times that events are compared against, so we
+        //       nudge the end of the segment to the first frame whose time is at or after the end.
+        while (segment_end > frame + 1 && time_of_frame(segment_end - 1) >= segment_end_time)
+            --segment_end;
+        while (segment_end < values.size() && time_of_frame(segment_end) < segment_end_time)
+            ++segment_end;
+
+        auto segment = values.slice(frame, segment_end - frame);
+        frame = segment_end;
+
+        if (is_in_value_curve) {
+            for (size_t i = 0; i < segment.size(); ++i)
+                segment[i] = value_curve_value(*previous, time + i * sample_duration);
+            continue;
+        }
+
+        if (next && next->is_ramp()) {
+            auto ramp_start_time = previous ? previous->end_time() : 0;
+            auto ramp_duration = next->time - ramp_start_time;
+            auto start_value = cursor.event_start_values[index];
+            auto first_value = ramp_value(cursor, index, time);
+
+            if (ramp_duration <= 0) {
+                segment.fill(first_value);
+            } else if (next->type == Event::Type::LinearRamp) {
+                fill_linear(segment, first_value, (next->value - start_value) * (sample_duration / ramp_duration));
+            } else if (start_value == 0 || (start_value < 0) != (next->value < 0)) {
+                segment.fill(start_value);
+            } else {
+                auto ratio = AK::pow(static_cast<double>(next->value) / start_value, sample_duration / ramp_duration);
+                fill_exponential(segment, 0, first_value, ratio);
+            }
+            continue;
+        }
+
+        if (previous && previous->type == Event::Type::SetTarget) {
+            // v(t) = V1 + (V0 − V1) * e^(−(t − T0) / τ), so the distance to the target shrinks by the same factor every
+            // frame.
+            auto distance = static_cast<double>(value_after_events(cursor, index, time)) - previous->value;
+            // NOTE: Once the distance has decayed to nothing, we fill in the target to stay clear of denormals.
+            if (AK::fabs(distance) < NumericLimits<float>::min_normal())
+                segment.fill(previous->value);
+            else
+                fill_exponential(segment, previous->value, distance, AK::exp(-sample_duration / previous->time_constant));
+            continue;
+        }
+
+        segment.fill(value_after_events(cursor, index, time));
+    }
+}
+
+}
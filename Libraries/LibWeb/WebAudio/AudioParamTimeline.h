@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <AK/Vector.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+// The list of automation events scheduled on an AudioParam. This is a plain value type so that a render graph can take
+// a copy of it and evaluate it away from the control thread.
+class AudioParamTimeline {
+public:
+    struct Event {
+        enum class Type : u8 {
+            SetValue,
+            LinearRamp,
+            ExponentialRamp,
+            SetTarget,
+            SetValueCurve,
+        };
+
+        Type type { Type::SetValue };
+
+        // The start time of the event, or the end time for ramps.
+        double time { 0 };
+
+        // The value of the event, or the target value for SetTarget events.
+        float value { 0 };
+
+        double time_constant { 0 };
+        double duration { 0 };
+        Vector<float> curve;
+
+        bool is_ramp() const { return type == Type::LinearRamp || type == Type::ExponentialRamp; }
+        double end_time() const { return type == Type::SetValueCurve ? time + duration : time; }
+    };
+
+    // The state of evaluating a timeline at increasing times, as a render thread does. It remembers which events have
+    // passed, and the value each event starts from, so that each render quantum only has to look at the events that
+    // fall within it.
+    struct Cursor {
+        float default_value { 0 };
+        size_t next_event_index { 0 };
+        // The value that event i starts from, which only depends on the events before it.
+        Vector<float> event_start_values;
+    };
+
+    bool is_empty() const { return m_events.is_empty(); }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
+    bool is_within_value_curve(double time) const;
+    bool has_event_within(double start_time, double end_time) const;
+
+    void insert(Event);
+
+    void cancel_scheduled_values(double cancel_time);
+    void cancel_and_hold(double cancel_time, float default_value);
+
+    Cursor create_cursor(float default_value) const;
+
+    float value_at_time(double time, float default_value) const;
+    float value_at_time(Cursor&, double time) const;
+
+    // Fills values with the value of the timeline at start_time, start_time + sample_duration, and so on.
+    void compute_values(Cursor&, Span<float> values, double start_time, double sample_duration) const;
+
+private:
+    void move_cursor_to(Cursor&, double time) const;
+    float value_after_events(Cursor const&, size_t event_count, double time) const;
+    float ramp_value(Cursor const&, size_t ramp_index, double time) const;
+
+    Vector<Event> m_events;
+};
+
+}
@@ -47,10 +47,12 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::start(double when)
     // 3. Set the internal slot [[source started]] on this AudioScheduledSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
+    // 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
+    // NOTE: The render graph picks up the start time when it is compiled.
+    m_start_time = when;
+
     // FIXME: 5. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
 
-    dbgln("FIXME: Implement AudioScheduledSourceNode::start");
     return {};
 }
 
@@ -66,9 +68,10 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::stop(double when)
     if (when < 0)
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "when must not be negative"sv };
 
-    // FIXME: 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    // 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    // NOTE: The render graph picks up the stop time when it is compiled.
+    m_stop_time = when;
 
-    dbgln("FIXME: Implement AudioScheduledSourceNode::stop");
     return {};
 }
 
@@ -24,11 +24,16 @@ public:
     WebIDL::ExceptionOr<void> start(double when = 0);
     WebIDL::ExceptionOr<void> stop(double when = 0);
 
+    // The times passed to start() and stop(), if they have been called.
+    Optional<double> start_time() const { return m_start_time; }
+    Optional<double> stop_time() const { return m_stop_time; }
+
 protected:
     AudioScheduledSourceNode(JS::Realm&, GC::Ref<BaseAudioContext>);
 
     bool source_started() const { return m_source_started; }
     void set_source_started(bool started) { m_source_started = started; }
+    void set_start_time(double when) { m_start_time = when; }
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
@@ -36,6 +41,9 @@ protected:
 private:
     // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-source-started-slot
     bool m_source_started { false };
+
+    Optional<double> m_start_time;
+    Optional<double> m_stop_time;
 };
 
 }
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/EventLoop.h>
+#include <LibThreading/Thread.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/EventNames.h>
@@ -15,6 +17,7 @@
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
 #include <LibWeb/WebAudio/OfflineAudioCompletionEvent.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 
 namespace Web::WebAudio {
 
@@ -119,11 +122,48 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::start_renderi
 
 void OfflineAudioContext::begin_offline_rendering(GC::Ref<WebIDL::Promise> promise)
 {
-    auto& realm = this->realm();
     // To begin offline rendering, the following steps MUST happen on a rendering thread that is created for the occasion.
-    // FIXME: 1: Given the current connections and scheduled changes, start rendering length sample-frames of audio into [[rendered buffer]]
-    // FIXME: 2: For every render quantum, check and suspend rendering if necessary.
-    // FIXME: 3: If a suspended context is resumed, continue to render the buffer.
+    // NOTE: The render graph has to be compiled here on the control thread, as it reads from the AudioNodes.
+    auto render_graph = RenderGraph::compile(*m_destination, sample_rate());
+
+    auto on_complete = [self = GC::make_root(*this), promise = GC::make_root(promise)](Vector<Vector<float>> rendered_channels) {
+        self->finish_offline_rendering(*promise, move(rendered_channels));
+    };
+
+    auto rendering_thread = Threading::Thread::construct(
+        [&main_thread_event_loop = Core::EventLoop::current(), render_graph = move(render_graph), length = m_length, number_of_channels = m_number_of_channels, on_complete = move(on_complete)] mutable -> intptr_t {
+            Vector<Vector<float>> rendered_channels;
+            rendered_channels.resize(number_of_channels);
+            for (auto& channel : rendered_channels)
+                channel.resize(length);
+
+            // 1: Given the current connections and scheduled changes, start rendering length sample-frames of audio into [[rendered buffer]]
+            for (size_t frame = 0; frame < length; frame += RENDER_QUANTUM_SIZE) {
+                // FIXME: 2: For every render quantum, check and suspend rendering if necessary.
+                // FIXME: 3: If a suspended context is resumed, continue to render the buffer.
+                auto const& output = render_graph->render_quantum();
+                auto frame_count = min<size_t>(RENDER_QUANTUM_SIZE, length - frame);
+                for (size_t channel = 0; channel < min(output.channels.size(), rendered_channels.size()); ++channel)
+                    output.channels[channel].span().trim(frame_count).copy_to(rendered_channels[channel].span().slice(frame, frame_count));
+            }
+
+            main_thread_event_loop.deferred_invoke([rendered_channels = move(rendered_channels), on_complete = move(on_complete)] mutable {
+                on_complete(move(rendered_channels));
+            });
+            return 0;
+        },
+        "OfflineAudioRender"sv);
+    rendering_thread->start();
+    rendering_thread->detach();
+}
+
+void OfflineAudioContext::finish_offline_rendering(GC::Ref<WebIDL::Promise> promise, Vector<Vector<float>> rendered_channels)
+{
+    auto& realm = this->realm();
+
+    for (size_t channel = 0; channel < rendered_channels.size(); ++channel)
+        rendered_channels[channel].span().copy_to(MUST(m_rendered_buffer->get_channel_data(channel))->data());
+
     // 4: Once the rendering is complete, queue a media element task to execute the following steps:
     queue_a_media_element_task(GC::create_function(heap(), [&realm, promise, this]() {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
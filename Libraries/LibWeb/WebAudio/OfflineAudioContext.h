@@ -55,6 +55,7 @@ private:
     GC::Ptr<AudioBuffer> m_rendered_buffer;
 
     void begin_offline_rendering(GC::Ref<WebIDL::Promise> promise);
+    void finish_offline_rendering(GC::Ref<WebIDL::Promise> promise, Vector<Vector<float>> rendered_channels);
 };
 
 }
@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
+#include <LibWeb/WebAudio/AudioBufferSourceNode.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/ConstantSourceNode.h>
+#include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+static_assert(RENDER_QUANTUM_SIZE % SIMD::vector_length<SIMD::f32x4> == 0);
+
+static void add_into(RenderQuantum& destination, RenderQuantum const& source)
+{
+    for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += SIMD::vector_length<SIMD::f32x4>) {
+        auto sum = SIMD::load_unaligned<SIMD::f32x4>(&destination[i]) + SIMD::load_unaligned<SIMD::f32x4>(&source[i]);
+        SIMD::store_unaligned(&destination[i], sum);
+    }
+}
+
+static void add_scaled_into(RenderQuantum& destination, RenderQuantum const& source, float scale)
+{
+    auto scale_vector = SIMD::expand4(scale);
+    for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += SIMD::vector_length<SIMD::f32x4>) {
+        auto sum = SIMD::load_unaligned<SIMD::f32x4>(&destination[i]) + SIMD::load_unaligned<SIMD::f32x4>(&source[i]) * scale_vector;
+        SIMD::store_unaligned(&destination[i], sum);
+    }
+}
+
+static void multiply_by(RenderQuantum& destination, RenderQuantum const& factors)
+{
+    for (size_t i = 0; i < RENDER_QUANTUM_SIZE; i += SIMD::vector_length<SIMD::f32x4>) {
+        auto product = SIMD::load_unaligned<SIMD::f32x4>(&destination[i]) * SIMD::load_unaligned<SIMD::f32x4>(&factors[i]);
+        SIMD::store_unaligned(&destination[i], product);
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+static void mix_into(AudioBus& destination, AudioBus const& source, Bindings::ChannelInterpretation interpretation)
+{
+    auto input_channels = source.channels.size();
+    auto output_channels = destination.channels.size();
+
+    if (interpretation == Bindings::ChannelInterpretation::Speakers && input_channels != output_channels) {
+        if (input_channels == 1 && (output_channels == 2 || output_channels == 4)) {
+            // Mono up-mix to stereo or quad:
+            //     output.L = input.M;
+            //     output.R = input.M;
+            add_into(destination.channels[0], source.channels[0]);
+            add_into(destination.channels[1], source.channels[0]);
+            return;
+        }
+        if (input_channels == 1 && output_channels == 6) {
+            // Mono up-mix to 5.1:
+            //     output.C = input.M;
+            add_into(destination.channels[2], source.channels[0]);
+            return;
+        }
+        if (input_channels == 2 && output_channels == 1) {
+            // Stereo down-mix to mono:
+            //     output.M = 0.5 * (input.L + input.R);
+            add_scaled_into(destination.channels[0], source.channels[0], 0.5f);
+            add_scaled_into(destination.channels[0], source.channels[1], 0.5f);
+            return;
+        }
+        // FIXME: Implement the remaining speaker layouts. Until then, they fall back to discrete mixing.
+    }
+
+    // Discrete: fill each output channel with its counterpart from the input, dropping or zero-filling the rest.
+    for (size_t channel = 0; channel < min(input_channels, output_channels); ++channel)
+        add_into(destination.channels[channel], source.channels[channel]);
+}
+
+void AudioBus::set_channel_count(size_t channel_count)
+{
+    channels.resize(channel_count);
+}
+
+void AudioBus::zero()
+{
+    for (auto& channel : channels)
+        channel.fill(0);
+}
+
+RenderParam::RenderParam(AudioParam const& param)
+    : m_timeline(param.timeline())
+    , m_intrinsic_value(param.intrinsic_value())
+    , m_timeline_cursor(m_timeline.create_cursor(m_intrinsic_value))
+    , m_min_value(param.min_value())
+    , m_max_value(param.max_value())
+    , m_is_k_rate(param.automation_rate() == Bindings::AutomationRate::KRate)
+{
+}
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+void RenderParam::process(size_t start_frame, float sample_rate)
+{
+    auto start_time = start_frame / static_cast<double>(sample_rate);
+
+    // 1. paramIntrinsicValue will be calculated at each time, which is either the value set directly to the value
+    //    attribute, or, if there are any automation events with times before or at this time, the value as calculated
+    //    from these events.
+    // NOTE: A k-rate param only takes a single value per render quantum, the one at the start of it.
+    if (m_is_k_rate)
+        m_values.fill(m_timeline.value_at_time(m_timeline_cursor, start_time));
+    else
+        m_timeline.compute_values(m_timeline_cursor, m_values.span(), start_time, 1.0 / sample_rate);
+
+    // 2. Set [[current value]] to the value of paramIntrinsicValue at the beginning of this render quantum.
+    // FIXME: Report the current value back to the control thread.
+
+    // 3. paramComputedValue is the sum of the paramIntrinsicValue value and the value of the input AudioParam buffer.
+    //    If the sum is NaN, replace the sum with the defaultValue.
+    if (!m_inputs.is_empty()) {
+        // The input AudioParam buffer is the sum of all the node outputs connected to this param, down-mixed to mono.
+        AudioBus input;
+        input.set_channel_count(1);
+        input.zero();
+        for (auto* node : m_inputs)
+            mix_into(input, node->output(), Bindings::ChannelInterpretation::Speakers);
+
+        if (m_is_k_rate)
+            m_values.fill(m_values[0] + input.channels[0][0]);
+        else
+            add_into(m_values, input.channels[0]);
+    }
+
+    // 4. Clamp the computed value to the simple nominal range.
+    for (auto& value : m_values)
+        value = clamp(value, m_min_value, m_max_value);
+}
+
+RenderNode::RenderNode(AudioNode& node)
+    : m_channel_count(node.channel_count())
+    , m_channel_count_mode(node.channel_count_mode())
+    , m_channel_interpretation(node.channel_interpretation())
+{
+}
+
+// https://webaudio.github.io/web-audio-api/#computednumberofchannels
+size_t RenderNode::computed_number_of_channels() const
+{
+    size_t max_input_channels = 1;
+    for (auto* input : m_inputs)
+        max_input_channels = max(max_input_channels, input->output().channels.size());
+
+    switch (m_channel_count_mode) {
+    case Bindings::ChannelCountMode::Max:
+        // computedNumberOfChannels is the maximum of the number of channels of all connections to an input.
+        return max_input_channels;
+    case Bindings::ChannelCountMode::ClampedMax:
+        // computedNumberOfChannels is determined as for "max" and then clamped to a maximum value of the given channelCount.
+        return min(max_input_channels, m_channel_count);
+    case Bindings::ChannelCountMode::Explicit:
+        // computedNumberOfChannels is the exact value as specified by the channelCount.
+        return m_channel_count;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void RenderNode::mix_inputs(AudioBus& bus) const
+{
+    bus.set_channel_count(computed_number_of_channels());
+    bus.zero();
+    for (auto* input : m_inputs)
+        mix_into(bus, input->output(), m_channel_interpretation);
+}
+
+namespace {
+
+// A node whose processing isn't implemented yet. It passes its mixed inputs through unchanged, so that the rest of the
+// graph downstream of it still gets rendered.
+class PassThroughRenderNode final : public RenderNode {
+public:
+    explicit PassThroughRenderNode(AudioNode& node)
+        : RenderNode(node)
+    {
+    }
+
+    virtual void process(size_t, float) override { mix_inputs(m_output); }
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioDestinationNode
+class DestinationRenderNode final : public RenderNode {
+public:
+    explicit DestinationRenderNode(AudioDestinationNode& node)
+        : RenderNode(node)
+    {
+    }
+
+    virtual void process(size_t, float) override
+    {
+        mix_inputs(m_output);
+    }
+};
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+class GainRenderNode final : public RenderNode {
+public:
+    explicit GainRenderNode(GainNode& node)
+        : RenderNode(node)
+        , m_gain(node.gain())
+    {
+    }
+
+    RenderParam& gain() { return m_gain; }
+
+    virtual void for_each_param(Function<void(RenderParam&)> const& callback) override { callback(m_gain); }
+
+    virtual void process(size_t, float) override
+    {
+        // Each sample of each channel of the input data of the GainNode MUST be multiplied by the computedValue of
+        // the gain AudioParam.
+        mix_inputs(m_output);
+        for (auto& channel : m_output.channels)
+            multiply_by(channel, m_gain.values());
+    }
+
+private:
+    RenderParam m_gain;
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioScheduledSourceNode
+class ScheduledSourceRenderNode : public RenderNode {
+protected:
+    ScheduledSourceRenderNode(AudioScheduledSourceNode& node, float sample_rate)
+        : RenderNode(node)
+    {
+        // NOTE: A source starts and stops at the first sample frame at or after the scheduled time.
+        if (auto start_time = node.start_time(); start_time.has_value())
+            m_start_frame = static_cast<size_t>(AK::ceil(*start_time * sample_rate));
+        if (auto stop_time = node.stop_time(); stop_time.has_value())
+            m_stop_frame = static_cast<size_t>(AK::ceil(*stop_time * sample_rate));
+    }
+
+    struct ActiveRange {
+        size_t begin { 0 };
+        size_t end { 0 };
+    };
+
+    // Returns the part of the render quantum starting at the given frame during which the source is playing, if any.
+    Optional<ActiveRange> active_range(size_t start_frame) const
+    {
+        if (!m_start_frame.has_value())
+            return {};
+        auto begin = max(start_frame, *m_start_frame);
+        auto end = start_frame + RENDER_QUANTUM_SIZE;
+        if (m_stop_frame.has_value())
+            end = min(end, *m_stop_frame);
+        if (begin >= end)
+            return {};
+        return ActiveRange { begin - start_frame, end - start_frame };
+    }
+
+    // Outputs a single channel of silence, which is what a source produces when it isn't playing.
+    void output_silence()
+    {
+        m_output.set_channel_count(1);
+        m_output.zero();
+    }
+
+private:
+    Optional<size_t> m_start_frame;
+    Optional<size_t> m_stop_frame;
+};
+
+// https://webaudio.github.io/web-audio-api/#ConstantSourceNode
+class ConstantSourceRenderNode final : public ScheduledSourceRenderNode {
+public:
+    ConstantSourceRenderNode(ConstantSourceNode& node, float sample_rate)
+        : ScheduledSourceRenderNode(node, sample_rate)
+        , m_offset(node.offset())
+    {
+    }
+
+    RenderParam& offset() { return m_offset; }
+
+    virtual void for_each_param(Function<void(RenderParam&)> const& callback) override { callback(m_offset); }
+
+    virtual void process(size_t start_frame, float) override
+    {
+        output_silence();
+        auto range = active_range(start_frame);
+        if (!range.has_value())
+            return;
+
+        auto& output = m_output.channels[0];
+        auto const& offset = m_offset.values();
+        for (size_t i = range->begin; i < range->end; ++i)
+            output[i] = offset[i];
+    }
+
+private:
+    RenderParam m_offset;
+};
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+class OscillatorRenderNode final : public ScheduledSourceRenderNode {
+public:
+    OscillatorRenderNode(OscillatorNode& node, float sample_rate)
+        : ScheduledSourceRenderNode(node, sample_rate)
+        , m_type(node.type())
+        , m_frequency(node.frequency())
+        , m_detune(node.detune())
+    {
+    }
+
+    RenderParam& frequency() { return m_frequency; }
+    RenderParam& detune() { return m_detune; }
+
+    virtual void for_each_param(Function<void(RenderParam&)> const& callback) override
+    {
+        callback(m_frequency);
+        callback(m_detune);
+    }
+
+    virtual void process(size_t start_frame, float sample_rate) override
+    {
+        output_silence();
+        auto range = active_range(start_frame);
+        if (!range.has_value())
+            return;
+
+        auto& output = m_output.channels[0];
+        auto const& frequency = m_frequency.values();
+        auto const& detune = m_detune.values();
+
+        for (size_t i = range->begin; i < range->end; ++i) {
+            output[i] = sample_at_phase(m_phase);
+
+            // computedOscFrequency(t) = frequency(t) * pow(2, detune(t) / 1200)
+            auto computed_frequency = static_cast<double>(frequency[i]);
+            if (detune[i] != 0)
+                computed_frequency *= AK::exp2(detune[i] / 1200.0);
+
+            m_phase += computed_frequency / sample_rate;
+            m_phase -= AK::floor(m_phase);
+        }
+    }
+
+private:
+    // https://webaudio.github.io/web-audio-api/#oscillator-coefficients
+    float sample_at_phase(double phase) const
+    {
+        switch (m_type) {
+        case Bindings::OscillatorType::Sine:
+            return static_cast<float>(AK::sin(2 * AK::Pi<double> * phase));
+        case Bindings::OscillatorType::Square:
+            return phase < 0.5 ? 1.0f : -1.0f;
+        case Bindings::OscillatorType::Sawtooth:
+            return static_cast<float>(2 * (phase - AK::floor(phase + 0.5)));
+        case Bindings::OscillatorType::Triangle: {
+            auto shifted_phase = phase - 0.25;
+            return static_cast<float>(1 - 4 * AK::fabs(shifted_phase - AK::floor(shifted_phase + 0.5)));
+        }
+        case Bindings::OscillatorType::Custom:
+            // FIXME: Synthesize the waveform described by the PeriodicWave.
+            return 0;
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    Bindings::OscillatorType m_type;
+    RenderParam m_frequency;
+    RenderParam m_detune;
+    double m_phase { 0 };
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioBufferSourceNode
+class AudioBufferSourceRenderNode final : public ScheduledSourceRenderNode {
+public:
+    AudioBufferSourceRenderNode(AudioBufferSourceNode& node, float sample_rate)
+        : ScheduledSourceRenderNode(node, sample_rate)
+        , m_playback_rate(node.playback_rate())
+        , m_detune(node.detune())
+        , m_loop(node.loop())
+    {
+        // https://webaudio.github.io/web-audio-api/#acquire-the-content
+        // NOTE: The render graph can't touch the AudioBuffer's channel data from the rendering thread, so we take a
+        //       copy of it up front.
+        if (auto buffer = node.buffer()) {
+            m_buffer_sample_rate = buffer->sample_rate();
+            m_buffer_length = buffer->length();
+            for (WebIDL::UnsignedLong channel = 0; channel < buffer->number_of_channels(); ++channel) {
+                Vector<float> channel_data;
+                channel_data.append(MUST(buffer->get_channel_data(channel))->data().data(), m_buffer_length);
+                m_buffer_channels.append(move(channel_data));
+            }
+        }
+
+        // https://webaudio.github.io/web-audio-api/#playback-AudioBufferSourceNode
+        // If loopStart and loopEnd don't describe a valid loop, the whole buffer is looped.
+        m_loop_start_frame = 0;
+        m_loop_end_frame = m_buffer_length;
+        auto loop_start = node.loop_start() * m_buffer_sample_rate;
+        auto loop_end = node.loop_end() * m_buffer_sample_rate;
+        if (loop_start >= 0 && loop_end > 0 && loop_start < loop_end) {
+            m_loop_start_frame = loop_start;
+            m_loop_end_frame = min(loop_end, static_cast<double>(m_buffer_length));
+        }
+
+        m_position = node.start_offset().value_or(0) * m_buffer_sample_rate;
+        if (auto duration = node.start_duration(); duration.has_value())
+            m_remaining_frames = *duration * m_buffer_sample_rate;
+    }
+
+    RenderParam& playback_rate() { return m_playback_rate; }
+    RenderParam& detune() { return m_detune; }
+
+    virtual void for_each_param(Function<void(RenderParam&)> const& callback) override
+    {
+        callback(m_playback_rate);
+        callback(m_detune);
+    }
+
+    virtual void process(size_t start_frame, float sample_rate) override
+    {
+        auto range = active_range(start_frame);
+        if (!range.has_value() || m_buffer_channels.is_empty() || m_finished) {
+            output_silence();
+            return;
+        }
+
+        m_output.set_channel_count(m_buffer_channels.size());
+        m_output.zero();
+
+        // NOTE: playbackRate and detune are always k-rate, so the rate is fixed for the whole render quantum.
+        // computedPlaybackRate(t) = playbackRate(t) * pow(2, detune(t) / 1200)
+        auto computed_playback_rate = static_cast<double>(m_playback_rate.first_value()) * AK::exp2(m_detune.first_value() / 1200.0);
+        auto step = computed_playback_rate * m_buffer_sample_rate / sample_rate;
+
+        for (size_t i = range->begin; i < range->end; ++i) {
+            if (m_remaining_frames.has_value() && *m_remaining_frames <= 0) {
+                m_finished = true;
+                break;
+            }
+
+            if (m_loop && m_loop_end_frame > m_loop_start_frame) {
+                auto loop_length = m_loop_end_frame - m_loop_start_frame;
+                if (m_position >= m_loop_end_frame)
+                    m_position = m_loop_start_frame + AK::fmod(m_position - m_loop_start_frame, loop_length);
+                else if (m_position < m_loop_start_frame && step < 0)
+                    m_position = m_loop_end_frame - AK::fmod(m_loop_start_frame - m_position, loop_length);
+            } else if (m_position < 0 || m_position >= m_buffer_length) {
+                m_finished = true;
+                break;
+            }
+
+            // Linearly interpolate between the two buffer frames around the playhead.
+            auto index = static_cast<size_t>(m_position);
+            auto fraction = static_cast<float>(m_position - index);
+            auto next_index = index + 1;
+            if (m_loop && next_index >= m_loop_end_frame)
+                next_index = static_cast<size_t>(m_loop_start_frame);
+
+            for (size_t channel = 0; channel < m_buffer_channels.size(); ++channel) {
+                auto const& data = m_buffer_channels[channel];
+                auto sample = data[index];
+                if (fraction != 0 && next_index < m_buffer_length)
+                    sample += (data[next_index] - sample) * fraction;
+                m_output.channels[channel][i] = sample;
+            }
+
+            m_position += step;
+            if (m_remaining_frames.has_value())
+                *m_remaining_frames -= AK::fabs(step);
+        }
+    }
+
+private:
+    RenderParam m_playback_rate;
+    RenderParam m_detune;
+    bool m_loop { false };
+
+    Vector<Vector<float>> m_buffer_channels;
+    float m_buffer_sample_rate { 0 };
+    size_t m_buffer_length { 0 };
+    double m_loop_start_frame { 0 };
+    double m_loop_end_frame { 0 };
+
+    // The playhead position, in frames of the buffer.
+    double m_position { 0 };
+    // How much of the buffer is left to play, in frames, if start() was given a duration.
+    Optional<double> m_remaining_frames;
+    bool m_finished { false };
+};
+
+}
+
+NonnullOwnPtr<RenderGraph> RenderGraph::compile(AudioDestinationNode& destination, float sample_rate)
+{
+    auto graph = adopt_own(*new RenderGraph(sample_rate));
+    auto* destination_render_node = graph->compile_node(destination);
+    VERIFY(destination_render_node);
+    VERIFY(graph->m_nodes.last().ptr() == destination_render_node);
+
+    // NOTE: The map is only used while compiling, and points at GC objects that the rendering thread must not touch.
+    graph->m_node_map.clear();
+    return graph;
+}
+
+void RenderGraph::compile_param_inputs(RenderParam& render_param, AudioParam const& param)
+{
+    for (auto input_node : param.input_nodes()) {
+        if (auto* input = compile_node(*input_node))
+            render_param.add_input(*input);
+    }
+}
+
+// Compiles the given node after all the nodes that feed into it, so that m_nodes ends up in topological order.
+RenderNode* RenderGraph::compile_node(AudioNode& node)
+{
+    // NOTE: If we reach a node that is still being compiled, we've found a cycle. Cycles without a DelayNode in them are
+    //       muted, and we don't render DelayNodes yet, so we simply drop the connection that closes the cycle.
+    if (auto it = m_node_map.find(&node); it != m_node_map.end())
+        return it->value;
+    m_node_map.set(&node, nullptr);
+
+    OwnPtr<RenderNode> render_node;
+
+    if (auto* destination = as_if<AudioDestinationNode>(node)) {
+        render_node = make<DestinationRenderNode>(*destination);
+    } else if (auto* gain_node = as_if<GainNode>(node)) {
+        auto gain_render_node = make<GainRenderNode>(*gain_node);
+        compile_param_inputs(gain_render_node->gain(), gain_node->gain());
+        render_node = move(gain_render_node);
+    } else if (auto* constant_source = as_if<ConstantSourceNode>(node)) {
+        auto constant_source_render_node = make<ConstantSourceRenderNode>(*constant_source, m_sample_rate);
+        compile_param_inputs(constant_source_render_node->offset(), constant_source->offset());
+        render_node = move(constant_source_render_node);
+    } else if (auto* oscillator = as_if<OscillatorNode>(node)) {
+        auto oscillator_render_node = make<OscillatorRenderNode>(*oscillator, m_sample_rate);
+        compile_param_inputs(oscillator_render_node->frequency(), oscillator->frequency());
+        compile_param_inputs(oscillator_render_node->detune(), oscillator->detune());
+        render_node = move(oscillator_render_node);
+    } else if (auto* buffer_source = as_if<AudioBufferSourceNode>(node)) {
+        auto buffer_source_render_node = make<AudioBufferSourceRenderNode>(*buffer_source, m_sample_rate);
+        compile_param_inputs(buffer_source_render_node->playback_rate(), buffer_source->playback_rate());
+        compile_param_inputs(buffer_source_render_node->detune(), buffer_source->detune());
+        render_node = move(buffer_source_render_node);
+    } else {
+        dbgln("FIXME: Render {} in the WebAudio render graph", node.class_name());
+        render_node = make<PassThroughRenderNode>(node);
+    }
+
+    for (auto const& connection : node.input_connections()) {
+        if (auto* input = compile_node(*connection.destination_node))
+            render_node->add_input(*input);
+    }
+
+    auto* result = render_node.ptr();
+    m_nodes.append(render_node.release_nonnull());
+    m_node_map.set(&node, result);
+    return result;
+}
+
+AudioBus const& RenderGraph::render_quantum()
+{
+    for (auto& node : m_nodes) {
+        node->for_each_param([&](RenderParam& param) {
+            param.process(m_current_frame, m_sample_rate);
+        });
+        node->process(m_current_frame, m_sample_rate);
+    }
+
+    m_current_frame += RENDER_QUANTUM_SIZE;
+    return m_nodes.last()->output();
+}
+
+}
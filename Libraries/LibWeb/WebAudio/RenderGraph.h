@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioNodePrototype.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebAudio/AudioParamTimeline.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#render-quantum-size
+static constexpr size_t RENDER_QUANTUM_SIZE = 128;
+
+using RenderQuantum = Array<float, RENDER_QUANTUM_SIZE>;
+
+class RenderNode;
+
+// The audio produced by a node's output during one render quantum.
+struct AudioBus {
+    void set_channel_count(size_t);
+    void zero();
+
+    Vector<RenderQuantum, 2> channels;
+};
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+// A snapshot of an AudioParam, together with the nodes whose output is added to its value.
+class RenderParam {
+public:
+    explicit RenderParam(AudioParam const&);
+
+    void add_input(RenderNode& node) { m_inputs.append(&node); }
+
+    // Computes the values of the param for the render quantum starting at the given frame.
+    void process(size_t start_frame, float sample_rate);
+
+    RenderQuantum const& values() const { return m_values; }
+    float first_value() const { return m_values[0]; }
+
+private:
+    AudioParamTimeline m_timeline;
+    float m_intrinsic_value { 0 };
+    // Remembers where the previous render quantum was in the timeline, so that we don't have to search for it again.
+    AudioParamTimeline::Cursor m_timeline_cursor;
+    float m_min_value { 0 };
+    float m_max_value { 0 };
+    bool m_is_k_rate { false };
+    Vector<RenderNode*> m_inputs;
+    RenderQuantum m_values {};
+};
+
+// A node of the render graph. These are created from AudioNodes on the control thread, but from then on don't touch
+// any GC objects, so they can be processed on a rendering thread.
+class RenderNode {
+public:
+    virtual ~RenderNode() = default;
+
+    // Produces the output of this node for the render quantum starting at the given frame. All inputs and params of
+    // this node have already been processed for that quantum.
+    virtual void process(size_t start_frame, float sample_rate) = 0;
+
+    AudioBus const& output() const { return m_output; }
+
+    void add_input(RenderNode& node) { m_inputs.append(&node); }
+    virtual void for_each_param(Function<void(RenderParam&)> const&) { }
+
+protected:
+    explicit RenderNode(AudioNode&);
+
+    // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+    // Sums all inputs of this node into the given bus, up- or down-mixing them to the computed number of channels.
+    void mix_inputs(AudioBus&) const;
+
+    size_t computed_number_of_channels() const;
+
+    AudioBus m_output;
+    Vector<RenderNode*> m_inputs;
+
+    size_t m_channel_count { 2 };
+    Bindings::ChannelCountMode m_channel_count_mode { Bindings::ChannelCountMode::Max };
+    Bindings::ChannelInterpretation m_channel_interpretation { Bindings::ChannelInterpretation::Speakers };
+};
+
+// A topologically ordered render plan for the part of an audio graph that can be heard at its destination.
+class RenderGraph {
+public:
+    // Compiles the nodes connected to the given destination. This must happen on the control thread.
+    static NonnullOwnPtr<RenderGraph> compile(AudioDestinationNode&, float sample_rate);
+
+    // Processes every node for the next render quantum, and returns what arrived at the destination.
+    AudioBus const& render_quantum();
+
+private:
+    explicit RenderGraph(float sample_rate)
+        : m_sample_rate(sample_rate)
+    {
+    }
+
+    RenderNode* compile_node(AudioNode&);
+    void compile_param_inputs(RenderParam&, AudioParam const&);
+
+    float m_sample_rate { 0 };
+    size_t m_current_frame { 0 };
+
+    // Nodes in the order they must be processed, with the destination last.
+    Vector<NonnullOwnPtr<RenderNode>> m_nodes;
+
+    // Maps each AudioNode that has been visited to its render node, or null while its inputs are still being compiled.
+    HashMap<AudioNode const*, RenderNode*> m_node_map;
+};
+
+}
@@ -9,6 +9,7 @@
 #include <AK/TemporaryChange.h>
 #include <AK/Time.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
 #include <LibCore/Timer.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
 #include <LibURL/Parser.h>
@@ -681,7 +682,11 @@ static ErrorOr<LexicalPath> save_screenshot(Gfx::Bitmap const* bitmap)
     auto file = AK::UnixDateTime::now().to_byte_string("screenshot-%Y-%m-%d-%H-%M-%S.png"sv);
     auto path = TRY(Application::the().path_for_downloaded_file(file));
 
-    auto encoded = TRY(Gfx::PNGWriter::encode(*bitmap));
+    // Screenshots are taken interactively, so favor encoding speed over file size.
+    auto encoded = TRY(Gfx::PNGWriter::encode(*bitmap, {
+        .compression_level = 1,
+        .thread_count = Core::System::hardware_concurrency(),
+    }));
 
     auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
     TRY(dump_file->write_until_depleted(encoded));
@@ -73,9 +73,12 @@ enum class Keyword : @keyword_underlying_type@ {
 )~~~");
     });
 
+    generator.set("keyword_count", String::number(keyword_data.size() + 1));
     generator.append(R"~~~(
 };
 
+constexpr size_t number_of_keywords = @keyword_count@;
+
 WEB_API Optional<Keyword> keyword_from_string(StringView);
 StringView string_from_keyword(Keyword);
 
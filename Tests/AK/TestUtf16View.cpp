@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
 #include <AK/Utf16String.h>
@@ -833,6 +834,57 @@ TEST_CASE(find_code_unit_offset)
     EXPECT_EQ(7u, view.find_code_unit_offset(u"bar"sv).value());
 
     EXPECT(!view.find_code_unit_offset(u"baz"sv).has_value());
+
+    // Matches may begin in the middle of a surrogate pair.
+    EXPECT_EQ(1u, view.find_code_unit_offset(Utf16View { view.substring_view(1, 2) }).value());
+
+    EXPECT_EQ(2u, view.find_code_unit_offset("foo"sv).value());
+    EXPECT_EQ(1u, Utf16View { "afoo"sv }.find_code_unit_offset(u"foo"sv).value());
+    EXPECT(!Utf16View { "afoo"sv }.find_code_unit_offset(u"😀"sv).has_value());
+}
+
+TEST_CASE(find_code_unit_offset_in_long_string)
+{
+    auto build = [](StringView prefix, size_t repetitions, StringView needle) {
+        StringBuilder builder(StringBuilder::Mode::UTF16);
+        builder.append(prefix);
+        for (size_t i = 0; i < repetitions; ++i)
+            builder.append("abcabcab"sv);
+        builder.append(needle);
+        builder.append("abc"sv);
+        return builder.to_utf16_string();
+    };
+
+    for (auto prefix : { ""sv, "😀"sv }) {
+        for (size_t repetitions = 0; repetitions < 8; ++repetitions) {
+            auto haystack = build(prefix, repetitions, "abcd"sv);
+            auto expected_offset = Utf16String::from_utf8(prefix).length_in_code_units() + repetitions * 8;
+
+            EXPECT_EQ(haystack.find_code_unit_offset(u"abcd"sv).value(), expected_offset);
+            EXPECT_EQ(haystack.find_code_unit_offset("abcd"sv).value(), expected_offset);
+            EXPECT_EQ(haystack.utf16_view().find_last_code_unit_offset(u"abcd"sv, haystack.length_in_code_units()).value(), expected_offset);
+            EXPECT(!haystack.find_code_unit_offset(u"abcd"sv, expected_offset + 1).has_value());
+            EXPECT(!haystack.find_code_unit_offset(u"abce"sv).has_value());
+        }
+    }
+}
+
+TEST_CASE(find_last_code_unit_offset)
+{
+    auto conversion_result = Utf16String::from_utf8("😀foo😀bar😀foo"sv);
+    Utf16View const view { conversion_result };
+
+    EXPECT_EQ(4u, view.find_last_code_unit_offset(u""sv, 4).value());
+    EXPECT_EQ(15u, view.find_last_code_unit_offset(u""sv, 20).value());
+
+    EXPECT_EQ(10u, view.find_last_code_unit_offset(u"😀"sv, 15).value());
+    EXPECT_EQ(5u, view.find_last_code_unit_offset(u"😀"sv, 9).value());
+    EXPECT_EQ(12u, view.find_last_code_unit_offset(u"foo"sv, 12).value());
+    EXPECT_EQ(2u, view.find_last_code_unit_offset(u"foo"sv, 11).value());
+    EXPECT_EQ(2u, view.find_last_code_unit_offset("foo"sv, 11).value());
+
+    EXPECT(!view.find_last_code_unit_offset(u"foo"sv, 1).has_value());
+    EXPECT(!view.find_last_code_unit_offset(u"baz"sv, 15).has_value());
 }
 
 TEST_CASE(find_code_unit_offset_ignoring_case)
@@ -850,3 +902,17 @@ TEST_CASE(find_code_unit_offset_ignoring_case)
     EXPECT_EQ(7u, view.find_code_unit_offset_ignoring_case(u"baR"sv).value());
     EXPECT(!view.find_code_unit_offset_ignoring_case(u"baz"sv).has_value());
 }
+
+BENCHMARK_CASE(find_code_unit_offset_in_large_string)
+{
+    StringBuilder builder(StringBuilder::Mode::UTF16);
+    for (size_t i = 0; i < 100'000; ++i)
+        builder.append("[info] request handled in 12ms; "sv);
+    builder.append("[error] request failed"sv);
+    auto haystack = builder.to_utf16_string();
+
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT(haystack.find_code_unit_offset(u"[error]"sv).has_value());
+        EXPECT(!haystack.find_code_unit_offset(u"[debug]"sv).has_value());
+    }
+}
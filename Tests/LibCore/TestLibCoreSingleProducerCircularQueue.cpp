@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/String.h>
+#include <LibCore/SingleProducerCircularQueue.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+using TestQueue = Core::SingleProducerCircularQueue<int, 16>;
+using QueueError = ErrorOr<int, TestQueue::QueueStatus>;
+
+TEST_CASE(simple_enqueue)
+{
+    TestQueue queue;
+    for (size_t i = 0; i < queue.size(); ++i)
+        MUST(queue.enqueue((int)i));
+
+    auto result = queue.enqueue(0);
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.release_error(), TestQueue::QueueStatus::Full);
+    EXPECT_EQ(queue.weak_used(), queue.size());
+}
+
+TEST_CASE(simple_dequeue)
+{
+    TestQueue queue;
+    auto const test_count = 10;
+    for (int i = 0; i < test_count; ++i)
+        MUST(queue.enqueue(i));
+    for (int i = 0; i < test_count; ++i) {
+        auto const element = MUST(queue.dequeue());
+        EXPECT_EQ(element, i);
+    }
+
+    auto result = queue.dequeue();
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.release_error(), TestQueue::QueueStatus::Empty);
+}
+
+TEST_CASE(wrap_around)
+{
+    TestQueue queue;
+    for (int i = 0; i < (int)queue.size() * 3; ++i) {
+        MUST(queue.enqueue(i));
+        MUST(queue.enqueue(i));
+        EXPECT_EQ(MUST(queue.dequeue()), i);
+        EXPECT_EQ(MUST(queue.dequeue()), i);
+    }
+    EXPECT(queue.weak_is_empty());
+}
+
+TEST_CASE(non_trivial_elements)
+{
+    Core::SingleProducerCircularQueue<String, 4> queue;
+    MUST(queue.enqueue("well, hello friends"_string));
+    MUST(queue.enqueue("this string is long enough to be allocated"_string));
+    EXPECT_EQ(MUST(queue.dequeue()), "well, hello friends"sv);
+
+    queue.discard_enqueued();
+    EXPECT(queue.dequeue().is_error());
+    EXPECT(queue.weak_is_empty());
+}
+
+TEST_CASE(discard_enqueued)
+{
+    TestQueue queue;
+    for (int i = 0; i < 10; ++i)
+        MUST(queue.enqueue(i));
+    EXPECT_EQ(MUST(queue.dequeue()), 0);
+
+    // Discarded elements keep taking up space until the next dequeue.
+    queue.discard_enqueued();
+    EXPECT_EQ(queue.weak_used(), 9u);
+    for (int i = 10; i < 17; ++i)
+        MUST(queue.enqueue(i));
+    EXPECT(!queue.can_enqueue());
+
+    // Only the elements enqueued after the discard are returned.
+    for (int i = 10; i < 17; ++i)
+        EXPECT_EQ(MUST(queue.dequeue()), i);
+    EXPECT(queue.dequeue().is_error());
+    EXPECT(queue.weak_is_empty());
+
+    // Discarding again only affects the elements enqueued since then, and works across wrapping around.
+    for (int i = 0; i < 12; ++i)
+        MUST(queue.enqueue(i));
+    queue.discard_enqueued();
+    MUST(queue.enqueue(100));
+    EXPECT_EQ(MUST(queue.dequeue()), 100);
+    EXPECT(queue.weak_is_empty());
+}
+
+// There is one parallel consumer and one parallel producer.
+TEST_CASE(producer_consumer_multithread)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA TestQueue queue;
+    // Ensure that we have the possibility of filling the queue up.
+    auto const test_count = queue.size() * 64;
+
+    auto second_thread = Threading::Thread::construct([&queue]() {
+        for (size_t i = 0; i < test_count; ++i) {
+            QueueError result = TestQueue::QueueStatus::Invalid;
+            do {
+                result = queue.dequeue();
+                if (!result.is_error())
+                    EXPECT_EQ(result.value(), (int)i);
+            } while (result.is_error() && result.error() == TestQueue::QueueStatus::Empty);
+
+            if (result.is_error())
+                FAIL("Unexpected error while dequeueing.");
+        }
+        return 0;
+    });
+    second_thread->start();
+
+    for (size_t i = 0; i < test_count; ++i) {
+        ErrorOr<void, TestQueue::QueueStatus> result = TestQueue::QueueStatus::Invalid;
+        do {
+            result = queue.enqueue((int)i);
+        } while (result.is_error() && result.error() == TestQueue::QueueStatus::Full);
+
+        if (result.is_error())
+            FAIL("Unexpected error while enqueueing.");
+    }
+
+    (void)second_thread->join();
+
+    EXPECT(queue.weak_is_empty());
+}
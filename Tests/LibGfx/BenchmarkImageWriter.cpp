@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibCore/System.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibGfx/ImageFormats/WebPWriter.h>
+#include <LibTest/TestCase.h>
+
+// Roughly what a screenshot of a page looks like: large flat areas with some gradients and detail.
+static NonnullRefPtr<Gfx::Bitmap> create_screenshot_like_bitmap()
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 1920, 1080 }));
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x) {
+            Gfx::Color color = Gfx::Color::White;
+            if (y < 80)
+                color = Gfx::Color(40, 40, 40 + (y / 2));
+            else if ((y / 20) % 3 == 0 && (x / 7) % 5 != 0)
+                color = Gfx::Color((x * y) % 256, x % 256, y % 256);
+            bitmap->set_pixel(x, y, color);
+        }
+    }
+    return bitmap;
+}
+
+static auto bitmap = create_screenshot_like_bitmap();
+
+BENCHMARK_CASE(png_default)
+{
+    (void)MUST(Gfx::PNGWriter::encode(*bitmap));
+}
+
+BENCHMARK_CASE(png_fast)
+{
+    (void)MUST(Gfx::PNGWriter::encode(*bitmap, { .compression_level = 1, .filter = Gfx::PNGFilterStrategy::Up }));
+}
+
+BENCHMARK_CASE(png_fast_parallel)
+{
+    (void)MUST(Gfx::PNGWriter::encode(*bitmap, { .compression_level = 1, .thread_count = Core::System::hardware_concurrency() }));
+}
+
+BENCHMARK_CASE(webp_lossless)
+{
+    AllocatingMemoryStream stream;
+    MUST(Gfx::WebPWriter::encode(stream, *bitmap));
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibGfx/PixelConversion.h>
+#include <LibTest/TestCase.h>
+
+// The number of pixels in a 1080p frame.
+static constexpr size_t PIXEL_COUNT = 1920 * 1080;
+
+static Vector<u32> create_pixels()
+{
+    Vector<u32> pixels;
+    pixels.resize(PIXEL_COUNT);
+    u32 state = 0x12345678;
+    for (auto& pixel : pixels) {
+        state = (state * 1664525) + 1013904223;
+        pixel = state;
+    }
+    return pixels;
+}
+
+static auto source_pixels = create_pixels();
+
+BENCHMARK_CASE(swap_red_and_blue)
+{
+    Vector<u32> pixels;
+    pixels.resize(PIXEL_COUNT);
+    for (size_t i = 0; i < 10; ++i)
+        Gfx::PixelConversion::swap_red_and_blue(source_pixels, pixels);
+}
+
+BENCHMARK_CASE(premultiply_alpha)
+{
+    Vector<u32> pixels;
+    pixels.resize(PIXEL_COUNT);
+    for (size_t i = 0; i < 10; ++i)
+        Gfx::PixelConversion::premultiply_alpha(source_pixels, pixels);
+}
+
+BENCHMARK_CASE(unpremultiply_alpha)
+{
+    Vector<u32> pixels;
+    pixels.resize(PIXEL_COUNT);
+    for (size_t i = 0; i < 10; ++i)
+        Gfx::PixelConversion::unpremultiply_alpha(source_pixels, pixels);
+}
+
+BENCHMARK_CASE(convert_bgrx_to_rgb)
+{
+    Vector<u8> bytes;
+    bytes.resize(PIXEL_COUNT * 3);
+    for (size_t i = 0; i < 10; ++i)
+        Gfx::PixelConversion::convert_bgrx_to_rgb(source_pixels, bytes);
+}
+
+BENCHMARK_CASE(convert_cmyk_to_bgrx)
+{
+    ReadonlySpan<Gfx::CMYK> cmyk_pixels { reinterpret_cast<Gfx::CMYK const*>(source_pixels.data()), PIXEL_COUNT };
+    Vector<u32> pixels;
+    pixels.resize(PIXEL_COUNT);
+    for (size_t i = 0; i < 10; ++i)
+        Gfx::PixelConversion::convert_cmyk_to_bgrx(cmyk_pixels, pixels);
+}
+
+BENCHMARK_CASE(convert_ycck_to_cmyk)
+{
+    Vector<Gfx::CMYK> pixels;
+    pixels.resize(PIXEL_COUNT);
+    for (size_t i = 0; i < 10; ++i) {
+        memcpy(pixels.data(), source_pixels.data(), PIXEL_COUNT * sizeof(u32));
+        Gfx::PixelConversion::convert_ycck_to_cmyk(pixels);
+    }
+}
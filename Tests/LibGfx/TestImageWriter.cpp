@@ -5,6 +5,7 @@
  */
 
 #include <AK/MemoryStream.h>
+#include <LibCore/MappedFile.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/BMPLoader.h>
 #include <LibGfx/ImageFormats/BMPWriter.h>
@@ -16,6 +17,8 @@
 #include <LibGfx/ImageFormats/WebPWriter.h>
 #include <LibTest/TestCase.h>
 
+#define TEST_INPUT(x) ("test-inputs/" x)
+
 static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> expect_single_frame(Gfx::ImageDecoderPlugin& plugin_decoder)
 {
     EXPECT_EQ(plugin_decoder.frame_count(), 1u);
@@ -108,12 +111,80 @@ TEST_CASE(test_jpeg)
     (void)TRY_OR_FAIL((get_roundtrip_bitmap<Gfx::JPEGWriter, Gfx::JPEGImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgb_bitmap()))));
 }
 
+TEST_CASE(test_jpeg_chroma_subsampling)
+{
+    auto bitmap = TRY_OR_FAIL(create_test_rgb_bitmap());
+
+    for (auto chroma_subsampling : { Gfx::JPEGChromaSubsampling::Yuv444, Gfx::JPEGChromaSubsampling::Yuv422, Gfx::JPEGChromaSubsampling::Yuv420 }) {
+        auto encoded_data = TRY_OR_FAIL(encode_bitmap<Gfx::JPEGWriter>(bitmap, Gfx::JPEGEncoderOptions { .chroma_subsampling = chroma_subsampling }));
+        auto decoded = TRY_OR_FAIL(expect_single_frame_of_size(*TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(encoded_data)), bitmap->size()));
+
+        // The test image is a smooth gradient, which should survive compression at the default quality fairly well.
+        for (int y = 0; y < bitmap->height(); ++y) {
+            for (int x = 0; x < bitmap->width(); ++x) {
+                auto expected = bitmap->get_pixel(x, y);
+                auto actual = decoded->get_pixel(x, y);
+                EXPECT(AK::abs(expected.red() - actual.red()) <= 16);
+                EXPECT(AK::abs(expected.green() - actual.green()) <= 16);
+                EXPECT(AK::abs(expected.blue() - actual.blue()) <= 16);
+            }
+        }
+    }
+}
+
 TEST_CASE(test_png)
 {
     TRY_OR_FAIL((test_roundtrip<Gfx::PNGWriter, Gfx::PNGImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgb_bitmap()))));
     TRY_OR_FAIL((test_roundtrip<Gfx::PNGWriter, Gfx::PNGImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgba_bitmap()))));
 }
 
+TEST_CASE(test_png_options)
+{
+    auto bitmap = TRY_OR_FAIL(create_test_rgba_bitmap());
+
+    for (auto filter : { Gfx::PNGFilterStrategy::Adaptive, Gfx::PNGFilterStrategy::None, Gfx::PNGFilterStrategy::Sub, Gfx::PNGFilterStrategy::Up, Gfx::PNGFilterStrategy::Average, Gfx::PNGFilterStrategy::Paeth }) {
+        for (u8 compression_level : { 0, 1, 9 }) {
+            Gfx::PNGWriterOptions options;
+            options.filter = filter;
+            options.compression_level = compression_level;
+            auto encoded_data = TRY_OR_FAIL(encode_bitmap<Gfx::PNGWriter>(bitmap, options));
+            auto decoded_bitmap = TRY_OR_FAIL(expect_single_frame_of_size(*TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(encoded_data)), bitmap->size()));
+            expect_bitmaps_equal(*decoded_bitmap, *bitmap);
+        }
+    }
+}
+
+TEST_CASE(test_png_parallel)
+{
+    // Tall enough to be split into several strips.
+    auto bitmap = TRY_OR_FAIL(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 47, 333 }));
+    for (int y = 0; y < bitmap->height(); ++y)
+        for (int x = 0; x < bitmap->width(); ++x)
+            bitmap->set_pixel(x, y, Gfx::Color((x * 255) / bitmap->width(), y % 256, (x * y) % 256, 255 - (y % 7)));
+
+    auto icc_file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("icc/p3-v4.icc"sv)));
+    auto icc_data = icc_file->bytes();
+
+    for (auto filter : { Gfx::PNGFilterStrategy::Adaptive, Gfx::PNGFilterStrategy::Paeth }) {
+        for (size_t thread_count : { 2, 4, 16 }) {
+            Gfx::PNGWriterOptions options;
+            options.icc_data = icc_data;
+            options.compression_level = 1;
+            options.filter = filter;
+            options.thread_count = thread_count;
+            auto encoded_data = TRY_OR_FAIL(encode_bitmap<Gfx::PNGWriter>(bitmap, options));
+
+            auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(encoded_data));
+            auto decoded_icc_data = TRY_OR_FAIL(plugin_decoder->icc_data());
+            EXPECT(decoded_icc_data.has_value());
+            EXPECT(decoded_icc_data.value() == icc_data);
+
+            auto decoded_bitmap = TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, bitmap->size()));
+            expect_bitmaps_equal(*decoded_bitmap, *bitmap);
+        }
+    }
+}
+
 TEST_CASE(test_webp)
 {
     TRY_OR_FAIL((test_roundtrip<Gfx::WebPWriter, Gfx::WebPImageDecoderPlugin>(TRY_OR_FAIL(create_test_rgb_bitmap()))));
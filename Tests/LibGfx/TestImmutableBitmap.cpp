@@ -10,6 +10,8 @@
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibTest/TestCase.h>
 
+#include <core/SkImage.h>
+
 TEST_CASE(export_to_byte_buffer)
 {
     enum class Premultiplied : u8 {
@@ -241,3 +243,40 @@ TEST_CASE(export_to_byte_buffer)
         }
     }
 }
+
+TEST_CASE(sk_image_for_size)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 4096, 4096 }));
+    auto immutable_bitmap = Gfx::ImmutableBitmap::create(bitmap);
+
+    auto image_for_size = [&](Gfx::IntSize size) {
+        auto image = immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>(size);
+        return Gfx::IntSize { image->width(), image->height() };
+    };
+
+    // Sizes that aren't at most half the size of the image get the image itself.
+    EXPECT_EQ(immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 4096, 4096 }).get(), immutable_bitmap->sk_image());
+    EXPECT_EQ(immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 3000, 3000 }).get(), immutable_bitmap->sk_image());
+    EXPECT_EQ(immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 8192, 8192 }).get(), immutable_bitmap->sk_image());
+
+    // Otherwise, the smallest level that is still at least as large as the requested size is used, in both directions.
+    EXPECT_EQ(image_for_size({ 2048, 2048 }), Gfx::IntSize(2048, 2048));
+    EXPECT_EQ(image_for_size({ 1000, 1000 }), Gfx::IntSize(1024, 1024));
+    EXPECT_EQ(image_for_size({ 1000, 3000 }), Gfx::IntSize(4096, 4096));
+    EXPECT_EQ(image_for_size({ 100, 1000 }), Gfx::IntSize(1024, 1024));
+    EXPECT_EQ(image_for_size({ 0, 0 }), Gfx::IntSize(1, 1));
+
+    // Going back to a larger level after a smaller one rebuilds it from the full image.
+    EXPECT_EQ(image_for_size({ 2048, 2048 }), Gfx::IntSize(2048, 2048));
+
+    // The same level is reused while it's the one in use.
+    auto first = immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 500, 500 });
+    auto second = immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 400, 400 });
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->width(), 512);
+
+    // Images that are too small to be worth downscaling are always drawn as they are.
+    auto small_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 100, 100 }));
+    auto small_immutable_bitmap = Gfx::ImmutableBitmap::create(small_bitmap);
+    EXPECT_EQ(small_immutable_bitmap->sk_image_for_size<sk_sp<SkImage>>({ 10, 10 }).get(), small_immutable_bitmap->sk_image());
+}
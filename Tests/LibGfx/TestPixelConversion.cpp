@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibGfx/PixelConversion.h>
+#include <LibTest/TestCase.h>
+
+// Enough pixels to cover several full vectors, and every length of the remainder after them.
+static constexpr size_t MAX_PIXEL_COUNT = 37;
+
+static Vector<u32> create_test_pixels(size_t count)
+{
+    Vector<u32> pixels;
+    u32 state = 0x12345678;
+    for (size_t i = 0; i < count; ++i) {
+        state = (state * 1664525) + 1013904223;
+        pixels.append(state);
+    }
+    return pixels;
+}
+
+static u8 channel(u32 pixel, u32 shift)
+{
+    return (pixel >> shift) & 0xff;
+}
+
+TEST_CASE(swap_red_and_blue)
+{
+    for (size_t count = 0; count <= MAX_PIXEL_COUNT; ++count) {
+        auto pixels = create_test_pixels(count);
+        Vector<u32> converted;
+        converted.resize(count);
+        Gfx::PixelConversion::swap_red_and_blue(pixels, converted);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(channel(converted[i], 0), channel(pixels[i], 16));
+            EXPECT_EQ(channel(converted[i], 8), channel(pixels[i], 8));
+            EXPECT_EQ(channel(converted[i], 16), channel(pixels[i], 0));
+            EXPECT_EQ(channel(converted[i], 24), channel(pixels[i], 24));
+        }
+
+        // Swapping in place twice gives back the original pixels.
+        Gfx::PixelConversion::swap_red_and_blue(converted, converted);
+        EXPECT_EQ(converted, pixels);
+    }
+}
+
+TEST_CASE(premultiply_alpha)
+{
+    // Every combination of a channel value and an alpha.
+    Vector<u32> pixels;
+    for (u32 alpha = 0; alpha < 256; ++alpha) {
+        for (u32 value = 0; value < 256; ++value)
+            pixels.append((alpha << 24) | (value << 16) | ((255 - value) << 8) | value);
+    }
+    // Not a multiple of the vector length.
+    pixels.append(0x80ff8040);
+
+    auto premultiplied = pixels;
+    Gfx::PixelConversion::premultiply_alpha(premultiplied, premultiplied);
+
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        auto alpha = channel(pixels[i], 24);
+        EXPECT_EQ(channel(premultiplied[i], 24), alpha);
+        for (u32 shift : { 0, 8, 16 }) {
+            auto expected = ((channel(pixels[i], shift) * alpha * 2) + 255) / 510;
+            EXPECT_EQ(channel(premultiplied[i], shift), expected);
+        }
+    }
+}
+
+TEST_CASE(unpremultiply_alpha)
+{
+    Vector<u32> pixels;
+    for (u32 alpha = 0; alpha < 256; ++alpha) {
+        for (u32 value = 0; value < 256; ++value)
+            pixels.append((alpha << 24) | (value << 16) | ((255 - value) << 8) | value);
+    }
+    pixels.append(0x80ff8040);
+
+    auto unpremultiplied = pixels;
+    Gfx::PixelConversion::unpremultiply_alpha(unpremultiplied, unpremultiplied);
+
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        auto alpha = channel(pixels[i], 24);
+        if (alpha == 0) {
+            EXPECT_EQ(unpremultiplied[i], 0u);
+            continue;
+        }
+        EXPECT_EQ(channel(unpremultiplied[i], 24), alpha);
+        for (u32 shift : { 0, 8, 16 }) {
+            auto expected = min(255u, ((channel(pixels[i], shift) * 510) + alpha) / (alpha * 2));
+            EXPECT_EQ(channel(unpremultiplied[i], shift), expected);
+        }
+    }
+
+    // Premultiplying and then unpremultiplying opaque pixels is lossless.
+    auto opaque_pixels = create_test_pixels(MAX_PIXEL_COUNT);
+    for (auto& pixel : opaque_pixels)
+        pixel |= 0xff000000;
+    auto roundtripped = opaque_pixels;
+    Gfx::PixelConversion::premultiply_alpha(roundtripped, roundtripped);
+    Gfx::PixelConversion::unpremultiply_alpha(roundtripped, roundtripped);
+    EXPECT_EQ(roundtripped, opaque_pixels);
+}
+
+TEST_CASE(convert_bgrx_to_rgb)
+{
+    for (size_t count = 0; count <= MAX_PIXEL_COUNT; ++count) {
+        auto pixels = create_test_pixels(count);
+        Vector<u8> converted;
+        converted.resize(count * 3);
+        Gfx::PixelConversion::convert_bgrx_to_rgb(pixels, converted);
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(converted[(i * 3) + 0], channel(pixels[i], 16));
+            EXPECT_EQ(converted[(i * 3) + 1], channel(pixels[i], 8));
+            EXPECT_EQ(converted[(i * 3) + 2], channel(pixels[i], 0));
+        }
+    }
+}
+
+TEST_CASE(convert_cmyk_to_bgrx)
+{
+    for (size_t count = 0; count <= MAX_PIXEL_COUNT; ++count) {
+        auto test_pixels = create_test_pixels(count);
+        Vector<Gfx::CMYK> pixels;
+        for (auto pixel : test_pixels)
+            pixels.append({ channel(pixel, 0), channel(pixel, 8), channel(pixel, 16), channel(pixel, 24) });
+
+        Vector<u32> converted;
+        converted.resize(count);
+        Gfx::PixelConversion::convert_cmyk_to_bgrx(pixels, converted);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto const& cmyk = pixels[i];
+            u8 k = 255 - cmyk.k;
+            auto expected = Gfx::Color((255 - cmyk.c) * k / 255, (255 - cmyk.m) * k / 255, (255 - cmyk.y) * k / 255);
+            EXPECT_EQ(converted[i], expected.value());
+        }
+    }
+}
+
+TEST_CASE(convert_ycck_to_cmyk)
+{
+    for (size_t count = 0; count <= MAX_PIXEL_COUNT; ++count) {
+        auto test_pixels = create_test_pixels(count);
+        Vector<Gfx::CMYK> pixels;
+        for (auto pixel : test_pixels)
+            pixels.append({ channel(pixel, 0), channel(pixel, 8), channel(pixel, 16), channel(pixel, 24) });
+
+        auto converted = pixels;
+        Gfx::PixelConversion::convert_ycck_to_cmyk(converted);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto y = pixels[i].c;
+            auto cb = pixels[i].m;
+            auto cr = pixels[i].y;
+            int r = y + 1.402f * (cr - 128);
+            int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
+            int b = y + 1.772f * (cb - 128);
+
+            // The vectorized arithmetic may be contracted differently, so allow for a rounding difference.
+            EXPECT(abs(converted[i].c - clamp(r, 0, 255)) <= 1);
+            EXPECT(abs(converted[i].m - clamp(g, 0, 255)) <= 1);
+            EXPECT(abs(converted[i].y - clamp(b, 0, 255)) <= 1);
+            EXPECT_EQ(converted[i].k, 255 - pixels[i].k);
+        }
+    }
+}
+
+TEST_CASE(invert_cmyk)
+{
+    Vector<Gfx::CMYK> pixels;
+    for (u32 value = 0; value < 256; ++value)
+        pixels.append({ static_cast<u8>(value), static_cast<u8>(255 - value), static_cast<u8>(value / 2), static_cast<u8>(value * 3) });
+
+    auto inverted = pixels;
+    Gfx::PixelConversion::invert_cmyk(inverted);
+
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        EXPECT_EQ(inverted[i].c, 255 - pixels[i].c);
+        EXPECT_EQ(inverted[i].m, 255 - pixels[i].m);
+        EXPECT_EQ(inverted[i].y, 255 - pixels[i].y);
+        EXPECT_EQ(inverted[i].k, 255 - pixels[i].k);
+    }
+}
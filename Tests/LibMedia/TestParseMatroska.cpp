@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
+#include <AK/ByteBuffer.h>
 #include <LibMedia/Containers/Matroska/MatroskaDemuxer.h>
 #include <LibTest/TestCase.h>
 
@@ -47,3 +49,152 @@ TEST_CASE(seek_in_multi_frame_blocks)
     EXPECT(coded_frame_after_backward_seek.timestamp() > AK::Duration::zero());
     EXPECT(coded_frame_after_backward_seek.timestamp() <= backward_seek_time);
 }
+
+TEST_CASE(seek_to_keyframes_in_any_order)
+{
+    auto matroska_reader = MUST(Media::Matroska::Reader::from_file("avc_in_matroska.mkv"sv));
+    u64 video_track = 0;
+    MUST(matroska_reader.for_each_track_of_type(Media::Matroska::TrackEntry::TrackType::Video, [&](Media::Matroska::TrackEntry const& track_entry) -> Media::DecoderErrorOr<IterationDecision> {
+        video_track = track_entry.track_number();
+        return IterationDecision::Break;
+    }));
+    EXPECT_NE(video_track, 0u);
+
+    Vector<AK::Duration> keyframe_timestamps;
+    auto reference_iterator = MUST(matroska_reader.create_sample_iterator(video_track));
+    while (true) {
+        auto block = reference_iterator.next_block();
+        if (block.is_error()) {
+            EXPECT(block.error().category() == Media::DecoderErrorCategory::EndOfStream);
+            break;
+        }
+        if (block.value().only_keyframes())
+            keyframe_timestamps.append(block.value().timestamp());
+    }
+    EXPECT(!keyframe_timestamps.is_empty());
+
+    auto has_cues = MUST(matroska_reader.has_cues_for_track(video_track));
+    auto iterator = MUST(matroska_reader.create_sample_iterator(video_track));
+    for (auto milliseconds : { 3000, 500, 1500, 4000, 0, 2500, 2600 }) {
+        auto target = AK::Duration::from_milliseconds(milliseconds);
+        iterator = MUST(matroska_reader.seek_to_random_access_point(iterator, target));
+        auto block = MUST(iterator.next_block());
+        EXPECT(block.only_keyframes());
+        if (block.timestamp() > target)
+            EXPECT_EQ(block.timestamp(), keyframe_timestamps.first());
+
+        if (!has_cues) {
+            auto expected_timestamp = keyframe_timestamps.first();
+            for (auto timestamp : keyframe_timestamps) {
+                if (timestamp <= target)
+                    expected_timestamp = timestamp;
+            }
+            EXPECT_EQ(block.timestamp(), expected_timestamp);
+        }
+    }
+}
+
+static void append_element_header(ByteBuffer& buffer, u32 element_id, u64 size)
+{
+    // Element IDs are stored without their leading zero octets.
+    auto id_size = sizeof(element_id) - (count_leading_zeroes(element_id) / 8);
+    for (auto i = id_size; i > 0; i--)
+        buffer.append(static_cast<u8>(element_id >> ((i - 1) * 8)));
+
+    // Always write the size as an 8-octet variable size integer, to keep this simple.
+    buffer.append(0x01);
+    for (auto shift = 48; shift >= 0; shift -= 8)
+        buffer.append(static_cast<u8>(size >> shift));
+}
+
+static void append_element(ByteBuffer& buffer, u32 element_id, ReadonlyBytes contents)
+{
+    append_element_header(buffer, element_id, contents.size());
+    buffer.append(contents);
+}
+
+static void append_unsigned_element(ByteBuffer& buffer, u32 element_id, u64 value)
+{
+    append_element_header(buffer, element_id, sizeof(value));
+    for (auto shift = 56; shift >= 0; shift -= 8)
+        buffer.append(static_cast<u8>(value >> shift));
+}
+
+// Creates a file without cues that is large enough for seeking in it to bisect the clusters. Each cluster is a second
+// long and contains four blocks, and only the first block of every third cluster is a keyframe. The block data is
+// full of cluster element IDs that don't start valid clusters.
+static constexpr u64 LARGE_FILE_CLUSTER_COUNT = 128;
+static constexpr size_t LARGE_FILE_BLOCK_DATA_SIZE = 16 * KiB;
+
+static ByteBuffer create_large_file_without_cues()
+{
+    ByteBuffer file;
+
+    ByteBuffer header;
+    append_element(header, 0x4282, "matroska"sv.bytes());
+    append_element(file, 0x1A45DFA3, header.bytes());
+
+    ByteBuffer segment;
+
+    ByteBuffer information;
+    append_unsigned_element(information, 0x2AD7B1, 1'000'000);
+    append_element(segment, 0x1549A966, information.bytes());
+
+    ByteBuffer track_entry;
+    append_unsigned_element(track_entry, 0xD7, 1);
+    append_unsigned_element(track_entry, 0x83, 1);
+    append_element(track_entry, 0x86, "V_VP9"sv.bytes());
+    ByteBuffer tracks;
+    append_element(tracks, 0xAE, track_entry.bytes());
+    append_element(segment, 0x1654AE6B, tracks.bytes());
+
+    auto block_data = MUST(ByteBuffer::create_zeroed(LARGE_FILE_BLOCK_DATA_SIZE));
+    for (size_t i = 0; i + 8 < block_data.size(); i += 4) {
+        block_data[i] = 0x1F;
+        block_data[i + 1] = 0x43;
+        block_data[i + 2] = 0xB6;
+        block_data[i + 3] = 0x75;
+    }
+
+    for (u64 cluster_index = 0; cluster_index < LARGE_FILE_CLUSTER_COUNT; cluster_index++) {
+        ByteBuffer cluster;
+        append_unsigned_element(cluster, 0xE7, cluster_index * 1000);
+        for (u16 block_index = 0; block_index < 4; block_index++) {
+            ByteBuffer block;
+            block.append(0x81);
+            block.append(static_cast<u8>((block_index * 250) >> 8));
+            block.append(static_cast<u8>(block_index * 250));
+            block.append(block_index == 0 && cluster_index % 3 == 0 ? 0x80 : 0x00);
+            block.append(block_data.bytes());
+            append_element(cluster, 0xA3, block.bytes());
+        }
+        append_element(segment, 0x1F43B675, cluster.bytes());
+    }
+
+    append_element(file, 0x18538067, segment.bytes());
+    return file;
+}
+
+TEST_CASE(seek_without_cues_in_large_file)
+{
+    auto file = create_large_file_without_cues();
+    EXPECT(file.size() > 4 * MiB);
+
+    auto matroska_reader = MUST(Media::Matroska::Reader::from_data(file.bytes()));
+    EXPECT(!MUST(matroska_reader.has_cues_for_track(1)));
+
+    auto expected_keyframe_timestamp = [](AK::Duration target) {
+        auto cluster_index = min(static_cast<u64>(target.to_milliseconds()) / 1000, LARGE_FILE_CLUSTER_COUNT - 1);
+        return AK::Duration::from_seconds(static_cast<i64>(cluster_index - (cluster_index % 3)));
+    };
+
+    // Nothing is known about the clusters before the first seek, so it has to bisect the whole segment.
+    auto iterator = MUST(matroska_reader.create_sample_iterator(1));
+    for (auto milliseconds : { 64'500, 127'999, 3'100, 100'000, 98'999, 101'250, 0, 200'000, 65'000, 1'999 }) {
+        auto target = AK::Duration::from_milliseconds(milliseconds);
+        iterator = MUST(matroska_reader.seek_to_random_access_point(iterator, target));
+        auto block = MUST(iterator.next_block());
+        EXPECT(block.only_keyframes());
+        EXPECT_EQ(block.timestamp(), expected_keyframe_timestamp(target));
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/Vector.h>
+#include <LibMedia/Audio/Resampler.h>
+#include <LibTest/TestCase.h>
+
+using Audio::Resampler;
+
+static Vector<float> generate_sine(double frequency, u32 sample_rate, size_t sample_count, u8 channel_count = 1)
+{
+    Vector<float> samples;
+    samples.ensure_capacity(sample_count * channel_count);
+    for (size_t i = 0; i < sample_count; ++i) {
+        auto value = static_cast<float>(AK::sin(2 * AK::Pi<double> * frequency * i / sample_rate));
+        for (u8 channel = 0; channel < channel_count; ++channel)
+            samples.unchecked_append(value);
+    }
+    return samples;
+}
+
+static Vector<float> resample(Resampler& resampler, ReadonlySpan<float> input)
+{
+    Vector<float> output;
+    MUST(resampler.process(input, output));
+    MUST(resampler.flush(output));
+    return output;
+}
+
+// Skips the start and end of the output, where the filter reaches past the edges of the input.
+static ReadonlySpan<float> steady_state(ReadonlySpan<float> samples)
+{
+    constexpr size_t margin = 512;
+    return samples.slice(margin, samples.size() - (2 * margin));
+}
+
+static double root_mean_square(ReadonlySpan<float> samples)
+{
+    double sum = 0;
+    for (auto sample : samples)
+        sum += static_cast<double>(sample) * sample;
+    return AK::sqrt(sum / static_cast<double>(samples.size()));
+}
+
+static constexpr Array qualities { Resampler::Quality::Fast, Resampler::Quality::Medium, Resampler::Quality::High };
+
+TEST_CASE(output_length)
+{
+    for (auto quality : qualities) {
+        auto resampler = MUST(Resampler::create(44100, 48000, 2, quality));
+        auto output = resample(*resampler, generate_sine(440, 44100, 44100, 2));
+        EXPECT_EQ(output.size(), 48000u * 2);
+
+        resampler = MUST(Resampler::create(48000, 8000, 1, quality));
+        output = resample(*resampler, generate_sine(440, 48000, 4800));
+        EXPECT_EQ(output.size(), 800u);
+    }
+}
+
+TEST_CASE(output_length_across_flush)
+{
+    // Flushing between two streams, as happens when the resampler is replaced, must not lose any of the samples held
+    // back from the first one.
+    auto resampler = MUST(Resampler::create(44100, 48000, 2, Resampler::Quality::Medium));
+    auto first_input = generate_sine(440, 44100, 4410, 2);
+    auto second_input = generate_sine(440, 44100, 22050, 2);
+
+    Vector<float> output;
+    constexpr size_t block_size = 441 * 2;
+    for (size_t offset = 0; offset < first_input.size(); offset += block_size)
+        MUST(resampler->process(first_input.span().slice(offset, min(block_size, first_input.size() - offset)), output));
+    MUST(resampler->flush(output));
+    EXPECT_EQ(output.size(), 4800u * 2);
+
+    for (size_t offset = 0; offset < second_input.size(); offset += block_size)
+        MUST(resampler->process(second_input.span().slice(offset, min(block_size, second_input.size() - offset)), output));
+    MUST(resampler->flush(output));
+    EXPECT_EQ(output.size(), (4800u + 24000u) * 2);
+}
+
+TEST_CASE(passband_is_preserved)
+{
+    // A tone well below both Nyquist frequencies must come out unchanged, and aligned with the input in time.
+    for (auto quality : qualities) {
+        auto resampler = MUST(Resampler::create(44100, 48000, 1, quality));
+        auto output = resample(*resampler, generate_sine(1000, 44100, 44100));
+        auto expected = generate_sine(1000, 48000, output.size());
+
+        auto output_span = steady_state(output);
+        auto expected_span = steady_state(expected);
+        float maximum_error = 0;
+        for (size_t i = 0; i < output_span.size(); ++i)
+            maximum_error = max(maximum_error, AK::fabs(output_span[i] - expected_span[i]));
+        EXPECT(maximum_error < 1e-3f);
+    }
+
+    for (auto quality : qualities) {
+        auto resampler = MUST(Resampler::create(48000, 24000, 1, quality));
+        auto output = resample(*resampler, generate_sine(5000, 48000, 48000));
+        EXPECT_APPROXIMATE_WITH_ERROR(root_mean_square(steady_state(output)), AK::sqrt(0.5), 1e-3);
+    }
+}
+
+TEST_CASE(stopband_is_attenuated)
+{
+    // When downsampling from 48kHz to 24kHz, an 18kHz tone would alias to 6kHz, so it must be filtered out.
+    struct TestCase {
+        Resampler::Quality quality;
+        double maximum_level;
+    };
+    constexpr Array test_cases {
+        TestCase { Resampler::Quality::Fast, 1e-3 },
+        TestCase { Resampler::Quality::Medium, 1e-4 },
+        TestCase { Resampler::Quality::High, 1e-5 },
+    };
+
+    for (auto const& test_case : test_cases) {
+        auto resampler = MUST(Resampler::create(48000, 24000, 1, test_case.quality));
+        auto output = resample(*resampler, generate_sine(18000, 48000, 48000));
+        EXPECT(root_mean_square(steady_state(output)) < test_case.maximum_level);
+    }
+}
+
+TEST_CASE(streaming_matches_single_block)
+{
+    auto input = generate_sine(3000, 22050, 22050, 2);
+
+    auto resampler = MUST(Resampler::create(22050, 48000, 2, Resampler::Quality::Medium));
+    auto expected = resample(*resampler, input);
+
+    // The resampler must be reusable after a flush, and must not care about how the input is split up.
+    Vector<float> output;
+    size_t offset = 0;
+    size_t block_size = 1;
+    while (offset < input.size()) {
+        auto count = min(block_size * 2, input.size() - offset);
+        MUST(resampler->process(input.span().slice(offset, count), output));
+        offset += count;
+        block_size = (block_size * 7 + 3) % 509;
+    }
+    MUST(resampler->flush(output));
+
+    EXPECT_EQ(output, expected);
+}
+
+BENCHMARK_CASE(resample_stereo_44100_to_48000)
+{
+    auto input = generate_sine(440, 44100, 44100 * 10, 2);
+    auto resampler = MUST(Resampler::create(44100, 48000, 2, Resampler::Quality::High));
+
+    Vector<float> output;
+    constexpr size_t block_size = 1024 * 2;
+    for (size_t offset = 0; offset < input.size(); offset += block_size) {
+        output.clear_with_capacity();
+        MUST(resampler->process(input.span().slice(offset, min(block_size, input.size() - offset)), output));
+    }
+    MUST(resampler->flush(output));
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025, Ladybird contributors
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibMedia/Providers/VideoDataProvider.h>
+
+#include "TestMediaCommon.h"
+
+static constexpr size_t VP9_IN_WEBM_FRAME_COUNT = 25;
+
+static NonnullRefPtr<Media::VideoDataProvider> create_video_data_provider(Core::MappedFile const& file)
+{
+    NonnullRefPtr<Media::Demuxer> demuxer = MUST(Media::Matroska::MatroskaDemuxer::from_data(file.bytes()));
+    auto track = MUST(demuxer->get_preferred_track_for_type(Media::TrackType::Video));
+    VERIFY(track.has_value());
+    return MUST(Media::VideoDataProvider::try_create(demuxer, track.release_value()));
+}
+
+static void expect_statistics_within_bounds(Media::VideoDataProvider const& provider)
+{
+    auto statistics = provider.statistics();
+    EXPECT(statistics.queue_size >= Media::VideoDataProvider::MIN_QUEUE_SIZE);
+    EXPECT(statistics.queue_size <= Media::VideoDataProvider::MAX_QUEUE_SIZE);
+}
+
+// Retrieves frames from the provider until it has retrieved the given number of them.
+static Vector<AK::Duration> retrieve_frames(Core::EventLoop& loop, Media::VideoDataProvider& provider, size_t count)
+{
+    auto time_limit = AK::Duration::from_seconds(5);
+    auto start_time = MonotonicTime::now_coarse();
+
+    Vector<AK::Duration> timestamps;
+    while (timestamps.size() < count) {
+        auto frame = provider.retrieve_frame();
+        if (frame.is_valid())
+            timestamps.append(frame.timestamp());
+        expect_statistics_within_bounds(provider);
+
+        if (MonotonicTime::now_coarse() - start_time >= time_limit) {
+            FAIL("Decoding timed out.");
+            break;
+        }
+
+        loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    }
+    return timestamps;
+}
+
+static void wait_for_end_of_stream(Core::EventLoop& loop, bool const& reached_end)
+{
+    auto time_limit = AK::Duration::from_seconds(5);
+    auto start_time = MonotonicTime::now_coarse();
+
+    while (!reached_end) {
+        if (MonotonicTime::now_coarse() - start_time >= time_limit) {
+            FAIL("Decoding timed out.");
+            return;
+        }
+        loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    }
+}
+
+static void set_end_of_stream_handler(Media::VideoDataProvider& provider, bool& reached_end)
+{
+    provider.set_error_handler([&](Media::DecoderError&& error) {
+        if (error.category() == Media::DecoderErrorCategory::EndOfStream) {
+            reached_end = true;
+            return;
+        }
+        FAIL("An error occurred while decoding.");
+    });
+}
+
+TEST_CASE(decode_all_frames)
+{
+    Core::EventLoop loop;
+    auto file = TRY_OR_FAIL(Core::MappedFile::map("./vp9_in_webm.webm"sv));
+    auto provider = create_video_data_provider(*file);
+    auto reached_end = false;
+    set_end_of_stream_handler(*provider, reached_end);
+
+    auto timestamps = retrieve_frames(loop, *provider, VP9_IN_WEBM_FRAME_COUNT);
+    EXPECT_EQ(timestamps.size(), VP9_IN_WEBM_FRAME_COUNT);
+    for (size_t i = 1; i < timestamps.size(); i++)
+        EXPECT(timestamps[i - 1] < timestamps[i]);
+
+    wait_for_end_of_stream(loop, reached_end);
+    EXPECT(!provider->retrieve_frame().is_valid());
+
+    provider->report_dropped_frames(2);
+    auto statistics = provider->statistics();
+    EXPECT_EQ(statistics.decoded_frame_count, VP9_IN_WEBM_FRAME_COUNT);
+    EXPECT_EQ(statistics.dropped_frame_count, 2u);
+}
+
+TEST_CASE(seek_discards_frames_from_before_the_seek)
+{
+    Core::EventLoop loop;
+    auto file = TRY_OR_FAIL(Core::MappedFile::map("./vp9_in_webm.webm"sv));
+
+    Vector<AK::Duration> all_timestamps;
+    {
+        auto provider = create_video_data_provider(*file);
+        auto reached_end = false;
+        set_end_of_stream_handler(*provider, reached_end);
+        all_timestamps = retrieve_frames(loop, *provider, VP9_IN_WEBM_FRAME_COUNT);
+        wait_for_end_of_stream(loop, reached_end);
+    }
+    VERIFY(all_timestamps.size() == VP9_IN_WEBM_FRAME_COUNT);
+
+    auto provider = create_video_data_provider(*file);
+    auto reached_end = false;
+    set_end_of_stream_handler(*provider, reached_end);
+
+    // Let the provider fill its queues with the first frames, and then seek past them.
+    auto first_timestamps = retrieve_frames(loop, *provider, 3);
+    EXPECT_EQ(first_timestamps.span(), all_timestamps.span().trim(3));
+
+    static constexpr size_t seek_frame_index = 16;
+    auto seek_target = all_timestamps[seek_frame_index];
+    Optional<AK::Duration> seek_result;
+    provider->seek(seek_target, Media::SeekMode::Accurate, [&](AK::Duration timestamp) {
+        seek_result = timestamp;
+    });
+
+    auto time_limit = AK::Duration::from_seconds(5);
+    auto start_time = MonotonicTime::now_coarse();
+    while (!seek_result.has_value()) {
+        if (MonotonicTime::now_coarse() - start_time >= time_limit) {
+            FAIL("Seeking timed out.");
+            return;
+        }
+        loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    }
+    EXPECT_EQ(seek_result.value(), seek_target);
+
+    // Every frame after the seek must come from the new position, starting with the frame at the seek target. A frame
+    // that was still being converted when the seek cleared the queues must not show up.
+    auto remaining_frame_count = VP9_IN_WEBM_FRAME_COUNT - seek_frame_index;
+    auto timestamps = retrieve_frames(loop, *provider, remaining_frame_count);
+    EXPECT_EQ(timestamps.span(), all_timestamps.span().slice(seek_frame_index));
+
+    wait_for_end_of_stream(loop, reached_end);
+    EXPECT(!provider->retrieve_frame().is_valid());
+
+    // The two frames around the seek target are decoded by the seek itself, the rest are decoded as usual.
+    auto statistics = provider->statistics();
+    EXPECT(statistics.decoded_frame_count >= remaining_frame_count - 2);
+    EXPECT_EQ(statistics.dropped_frame_count, 0u);
+}
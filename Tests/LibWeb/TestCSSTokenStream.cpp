@@ -8,6 +8,7 @@
 #include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 #include <LibWeb/CSS/Parser/TokenStream.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
 
 namespace Web::CSS::Parser {
 
@@ -95,4 +96,51 @@ TEST_CASE(marks)
     EXPECT_EQ(stream.remaining_token_count(), 7u);
 }
 
+TEST_CASE(tokenize_ascii_runs)
+{
+    auto tokens = Tokenizer::tokenize("some-long-identifier-prefix\\41 b long-ascii-prefix-before-\u00fcn\u00efcode\n    \t  -12.5e+3px \"a string long enough for a vector \\\"quoted\\\" end\" /* a comment that is longer than sixteen bytes */x"sv, "utf-8"sv);
+
+    Vector<Token> non_whitespace_tokens;
+    for (auto const& token : tokens) {
+        if (!token.is(Token::Type::Whitespace))
+            non_whitespace_tokens.append(token);
+    }
+    EXPECT_EQ(non_whitespace_tokens.size(), 6u);
+
+    EXPECT(non_whitespace_tokens[0].is(Token::Type::Ident));
+    EXPECT_EQ(non_whitespace_tokens[0].ident(), "some-long-identifier-prefixAb"_fly_string);
+
+    EXPECT(non_whitespace_tokens[1].is(Token::Type::Ident));
+    EXPECT_EQ(non_whitespace_tokens[1].ident(), "long-ascii-prefix-before-\u00fcn\u00efcode"_fly_string);
+
+    EXPECT(non_whitespace_tokens[2].is(Token::Type::Dimension));
+    EXPECT_EQ(non_whitespace_tokens[2].dimension_value(), -12500.0);
+    EXPECT_EQ(non_whitespace_tokens[2].dimension_unit(), "px"_fly_string);
+    EXPECT_EQ(non_whitespace_tokens[2].start_position().line, 1u);
+    EXPECT_EQ(non_whitespace_tokens[2].start_position().column, 7u);
+
+    EXPECT(non_whitespace_tokens[3].is(Token::Type::String));
+    EXPECT_EQ(non_whitespace_tokens[3].string(), "a string long enough for a vector \"quoted\" end"_fly_string);
+
+    EXPECT(non_whitespace_tokens[4].is(Token::Type::Ident));
+    EXPECT_EQ(non_whitespace_tokens[4].ident(), "x"_fly_string);
+    EXPECT_EQ(non_whitespace_tokens[4].start_position().line, 1u);
+    EXPECT_EQ(non_whitespace_tokens[4].start_position().column, 118u);
+
+    EXPECT(non_whitespace_tokens[5].is(Token::Type::EndOfFile));
+}
+
+BENCHMARK_CASE(tokenize_large_style_sheet)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.appendff(".framework-component-{}:hover > .framework-element--modifier {{\n    margin: 0 {}px 1.5rem;\n    font-family: \"Helvetica Neue\", sans-serif;\n    /* Generated from a template. */\n}}\n", i, i % 64);
+    auto style_sheet = builder.to_byte_string();
+
+    for (size_t i = 0; i < 10; ++i) {
+        auto tokens = Tokenizer::tokenize(style_sheet, "utf-8"sv);
+        EXPECT(tokens.last().is(Token::Type::EndOfFile));
+    }
+}
+
 }